@@ -1,22 +1,35 @@
 #pragma once
 
+boolean connectWifiFast();
+void batteryWake();
 void updateData();
-void drawProgress(uint8_t percentage, String text);
-void drawTime();
+void updateWeather(uint16_t budget);
+void showWeather(const WeatherModel *model);
+String getWeatherCacheKey();
+boolean loadCachedWeather();
+void saveCachedWeather(const WeatherModel *model);
+void initScreens();
+void showScreen(Screen *next);
+void networkTask(void *parameter);
+void drawProgress(uint8_t percentage, const char *text);
+void printDate(TextBuffer &text);
+void printClock(TextBuffer &text);
+void printMeridiem(TextBuffer &text);
 void drawWifiQuality();
 void drawCurrentWeather();
 void drawForecast();
 void drawForecastDetail(uint16_t x, uint16_t y, uint8_t dayIndex);
 void drawAstronomy();
-void drawCurrentWeatherDetail();
-void drawLabelValue(uint8_t line, String label, String value);
 void drawForecastTable(uint8_t start);
-void drawAbout();
+void printUptime(TextBuffer &text);
+void drawResetInfo();
 void drawSeparator(uint16_t y);
-String getTime(time_t *timestamp);
-const char *getMeteoconIconFromProgmem(String iconText);
-const char *getMiniMeteoconIconFromProgmem(String iconText);
-void drawForecast1(MiniGrafx *display, CarouselState *state, int16_t x, int16_t y);
-void drawForecast2(MiniGrafx *display, CarouselState *state, int16_t x, int16_t y);
-void drawForecast3(MiniGrafx *display, CarouselState *state, int16_t x, int16_t y);
+void printTime(TextBuffer &text, time_t timestamp);
+const char *getMeteoconIconFromProgmem(WeatherIcon icon);
+const char *getMiniMeteoconIconFromProgmem(WeatherIcon icon);
+void printFixed(TextBuffer &text, int32_t value, uint8_t decimals, uint8_t shown);
+int8_t getWifiQuality();
+void drawForecast1(int16_t x, int16_t y);
+void drawForecast2(int16_t x, int16_t y);
+void drawForecast3(int16_t x, int16_t y);
 void loadPropertiesFromSpiffs();
\ No newline at end of file
@@ -0,0 +1,859 @@
+#include "Canvas.h"
+
+enum CanvasCall
+{
+  CALL_FILL_BUFFER,
+  CALL_SET_PIXEL,
+  CALL_DRAW_RECT,
+  CALL_FILL_RECT,
+  CALL_FILL_CIRCLE,
+  CALL_DRAW_STRING,
+  CALL_DRAW_STRING_MAX_WIDTH,
+  CALL_DRAW_PALETTED_BITMAP
+};
+
+Canvas::Canvas(MiniGrafx *gfx) : dirtyRegions(gfx->getWidth(), gfx->getHeight())
+{
+  this->gfx = gfx;
+}
+
+Canvas::Canvas(MiniGrafx *band, DisplayDriver *display, const uint16_t *palette, uint8_t colors)
+    : dirtyRegions(display->width(), display->height())
+{
+  this->gfx = band;
+  this->display = display;
+  this->palette = palette;
+  this->colors = colors;
+  this->bandHeight = band->getHeight();
+}
+
+void Canvas::init()
+{
+  gfx->init();
+  if (isBanded())
+  {
+    // transparency is handled here, MiniGrafx gets a color no index maps to
+    uint16_t unused = 0;
+    boolean used = true;
+    while (used)
+    {
+      unused++;
+      used = false;
+      for (uint8_t i = 0; i < colors; i++)
+      {
+        used |= palette[i] == unused;
+      }
+    }
+    gfx->setTransparentColor(unused);
+  }
+  invalidate();
+}
+
+void Canvas::setRotation(uint8_t r)
+{
+  // MiniGrafx would take the size of the display for the size of the band
+  if (isBanded())
+  {
+    display->setRotation(r);
+  }
+  else
+  {
+    gfx->setRotation(r);
+  }
+  dirtyRegions.setBounds(getWidth(), getHeight());
+  invalidate();
+}
+
+uint16_t Canvas::getWidth()
+{
+  return isBanded() ? display->width() : gfx->getWidth();
+}
+
+uint16_t Canvas::getHeight()
+{
+  return isBanded() ? display->height() : gfx->getHeight();
+}
+
+void Canvas::setColor(uint16_t color)
+{
+  this->color = color;
+  gfx->setColor(ink(color));
+  if (listing() != nullptr)
+  {
+    displayList->setColor(color);
+  }
+}
+
+void Canvas::setTransparentColor(uint16_t transparentColor)
+{
+  this->transparentColor = transparentColor;
+  if (!isBanded())
+  {
+    gfx->setTransparentColor(transparentColor);
+  }
+  if (listing() != nullptr)
+  {
+    displayList->setTransparentColor(transparentColor);
+  }
+}
+
+int16_t Canvas::getTransparentColor()
+{
+  return transparentColor;
+}
+
+void Canvas::setFont(const char *fontData)
+{
+  this->fontData = fontData;
+  gfx->setFont(fontData);
+  if (listing() != nullptr)
+  {
+    displayList->setFont(fontData);
+  }
+}
+
+void Canvas::setTextAlignment(TEXT_ALIGNMENT textAlignment)
+{
+  this->textAlignment = textAlignment;
+  gfx->setTextAlignment(textAlignment);
+  if (listing() != nullptr)
+  {
+    displayList->setTextAlignment(textAlignment);
+  }
+}
+
+void Canvas::fillBuffer(uint8_t pal)
+{
+  if (listing() != nullptr)
+  {
+    displayList->fillBuffer(pal, getWidth(), getHeight());
+  }
+  if (isBanded() && drawing)
+  {
+    // a replayed full frame
+    clearBand(pal);
+    return;
+  }
+  if (isBanded())
+  {
+    background = pal;
+    invalidate();
+    return;
+  }
+  gfx->fillBuffer(pal);
+  frameCleared = true;
+  overflow = false;
+  currentCount = 0;
+  record(hashCall(CALL_FILL_BUFFER, &pal, sizeof(pal)), 0, 0, getWidth(), getHeight());
+}
+
+void Canvas::setPixel(uint16_t x, uint16_t y)
+{
+  if (!isBanded())
+  {
+    gfx->setPixel(x, y);
+  }
+  else if (drawing && overlapsBand(y, 1))
+  {
+    gfx->setPixel(x, y - bandTop);
+  }
+  if (listing() != nullptr)
+  {
+    displayList->setPixel(x, y);
+  }
+  uint16_t args[] = {x, y};
+  record(hashCall(CALL_SET_PIXEL, args, sizeof(args)), x, y, 1, 1);
+}
+
+void Canvas::drawRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  if (!isBanded())
+  {
+    gfx->drawRect(x, y, width, height);
+  }
+  else if (drawing)
+  {
+    fillBandRect(x, y, width, 1);
+    fillBandRect(x, y + height - 1, width, 1);
+    fillBandRect(x, y + 1, 1, height - 2);
+    fillBandRect(x + width - 1, y + 1, 1, height - 2);
+  }
+  if (listing() != nullptr)
+  {
+    displayList->drawRect(x, y, width, height);
+  }
+  uint16_t args[] = {x, y, width, height};
+  record(hashCall(CALL_DRAW_RECT, args, sizeof(args)), x, y, width, height);
+}
+
+void Canvas::fillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  if (!isBanded())
+  {
+    gfx->fillRect(x, y, width, height);
+  }
+  else if (drawing)
+  {
+    fillBandRect(x, y, width, height);
+  }
+  if (listing() != nullptr)
+  {
+    displayList->fillRect(x, y, width, height);
+  }
+  uint16_t args[] = {x, y, width, height};
+  record(hashCall(CALL_FILL_RECT, args, sizeof(args)), x, y, width, height);
+}
+
+void Canvas::fillCircle(uint16_t x0, uint16_t y0, uint16_t radius)
+{
+  if (!isBanded())
+  {
+    gfx->fillCircle(x0, y0, radius);
+  }
+  else if (drawing && overlapsBand(y0 - radius, 2 * radius + 1))
+  {
+    gfx->fillCircle(x0, y0 - bandTop, radius);
+  }
+  if (listing() != nullptr)
+  {
+    displayList->fillCircle(x0, y0, radius);
+  }
+  uint16_t args[] = {x0, y0, radius};
+  record(hashCall(CALL_FILL_CIRCLE, args, sizeof(args)), x0 - radius, y0 - radius, 2 * radius + 1, 2 * radius + 1);
+}
+
+void Canvas::drawString(int16_t x, int16_t y, const char *text)
+{
+  // the bounds are estimated on the raw UTF-8 text, which can only make
+  // multi-byte characters wider than they are drawn
+  uint16_t lineHeight = fontData != nullptr ? pgm_read_byte(fontData + 1) : 0;
+  uint16_t lines = 0;
+  uint16_t maxWidth = 0;
+  uint16_t start = 0;
+  uint16_t length = strlen(text);
+  for (uint16_t i = 0; i <= length; i++)
+  {
+    if (i == length || text[i] == '\n')
+    {
+      maxWidth = max(maxWidth, gfx->getStringWidth(text + start, i - start));
+      start = i + 1;
+      lines++;
+    }
+  }
+
+  int16_t left = x;
+  int16_t top = y;
+  switch (textAlignment)
+  {
+  case TEXT_ALIGN_CENTER_BOTH:
+    top -= lineHeight * lines / 2;
+    left -= maxWidth / 2;
+    break;
+  case TEXT_ALIGN_CENTER:
+    left -= maxWidth / 2;
+    break;
+  case TEXT_ALIGN_RIGHT:
+    left -= maxWidth;
+    break;
+  default:
+    break;
+  }
+
+  // one pixel of margin for rounding in the alignment
+  left--;
+  top--;
+  uint16_t width = maxWidth + 2;
+  uint16_t height = lineHeight * lines + 2;
+  if (!isBanded())
+  {
+    if (!drawCachedString(x, y, text, length, left, top, width, height))
+    {
+      renderString(x, y, text, length);
+    }
+  }
+  else if (drawing && overlapsBand(top, height))
+  {
+    renderString(x, y - bandTop, text, length);
+  }
+
+  if (listing() != nullptr)
+  {
+    displayList->drawString(x, y, text, length, left, top, width, height);
+  }
+  int16_t args[] = {x, y};
+  uint32_t hash = hashCall(CALL_DRAW_STRING, args, sizeof(args));
+  hash = hashBytes(hash, text, length);
+  record(hash, left, top, width, height);
+}
+
+void Canvas::drawString(int16_t x, int16_t y, const String &text)
+{
+  drawString(x, y, text.c_str());
+}
+
+uint16_t Canvas::drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, String text)
+{
+  uint16_t result = 0;
+  if (!isBanded())
+  {
+    result = gfx->drawStringMaxWidth(x, y, maxLineWidth, text);
+  }
+  else if (drawing && overlapsBand(y - 1, getHeight() - y + 1))
+  {
+    result = gfx->drawStringMaxWidth(x, y - bandTop, maxLineWidth, text);
+  }
+
+  // wrapping is not predicted, assume everything below the first line changed
+  if (listing() != nullptr)
+  {
+    displayList->drawStringMaxWidth(x, y, maxLineWidth, text.c_str(), text.length(), 0, y - 1, getWidth(),
+                                    getHeight() - y + 1);
+  }
+  int16_t args[] = {x, y, (int16_t)maxLineWidth};
+  uint32_t hash = hashCall(CALL_DRAW_STRING_MAX_WIDTH, args, sizeof(args));
+  hash = hashBytes(hash, text.c_str(), text.length());
+  record(hash, 0, y - 1, getWidth(), getHeight() - y + 1);
+  return result;
+}
+
+void Canvas::drawPalettedBitmapFromPgm(uint16_t x, uint16_t y, const char *palBmp)
+{
+  uint16_t width = pgm_read_byte(palBmp + 2) << 8 | pgm_read_byte(palBmp + 3);
+  uint16_t height = pgm_read_byte(palBmp + 4) << 8 | pgm_read_byte(palBmp + 5);
+  if (isBanded() && (!drawing || !overlapsBand(y, height)))
+  {
+    // nothing to draw
+  }
+  else if (pgm_read_byte(palBmp) == CANVAS_RLE_BITMAP_VERSION)
+  {
+    drawRleBitmap(x, y, palBmp, width, height);
+  }
+  else
+  {
+    // MiniGrafx takes the indices for colors, only right in paletted frames
+    gfx->drawPalettedBitmapFromPgm(x, y - bandTop, palBmp);
+  }
+
+  if (listing() != nullptr)
+  {
+    displayList->drawPalettedBitmapFromPgm(x, y, width, height, palBmp);
+  }
+  uintptr_t args[] = {x, y, (uintptr_t)palBmp};
+  record(hashCall(CALL_DRAW_PALETTED_BITMAP, args, sizeof(args)), x, y, width, height);
+}
+
+uint16_t Canvas::getStringWidth(const char *text, uint16_t length)
+{
+  return gfx->getStringWidth(text, length);
+}
+
+// Does what MiniGrafx::drawString() does, in a stack buffer instead of a
+// heap copy: UTF-8 is mapped to the Latin-1 range of the fonts and every
+// non empty line is drawn one line height below the previous one.
+void Canvas::renderString(int16_t x, int16_t y, const char *text, uint16_t length)
+{
+  // MiniGrafx falls back to its default font, which Canvas does not know
+  if (length > CANVAS_MAX_TEXT_LENGTH || fontData == nullptr)
+  {
+    gfx->drawString(x, y, String(text));
+    return;
+  }
+  char latin1[CANVAS_MAX_TEXT_LENGTH + 1];
+  uint16_t count = 0;
+  uint16_t lineBreaks = 0;
+  uint8_t last = 0;
+  for (uint16_t i = 0; i < length; i++)
+  {
+    uint8_t c = text[i];
+    if (c < 128)
+    {
+      last = 0;
+      latin1[count++] = c;
+      lineBreaks += c == '\n';
+      continue;
+    }
+    uint8_t lead = last;
+    last = c;
+    if (lead == 0xC2)
+    {
+      latin1[count++] = c;
+    }
+    else if (lead == 0xC3)
+    {
+      latin1[count++] = c | 0xC0;
+    }
+    else if (lead == 0x82 && c == 0xAC)
+    {
+      latin1[count++] = 0x80;
+    }
+  }
+  latin1[count] = '\0';
+
+  uint16_t lineHeight = pgm_read_byte(fontData + 1);
+  uint16_t yOffset = textAlignment == TEXT_ALIGN_CENTER_BOTH ? lineBreaks * lineHeight / 2 : 0;
+  uint16_t line = 0;
+  uint16_t start = 0;
+  for (uint16_t i = 0; i <= count; i++)
+  {
+    if (i < count && latin1[i] != '\n')
+    {
+      continue;
+    }
+    if (i > start)
+    {
+      latin1[i] = '\0';
+      gfx->drawStringInternal(x, y - yOffset + line++ * lineHeight, latin1 + start, i - start,
+                              gfx->getStringWidth(latin1 + start, i - start));
+    }
+    start = i + 1;
+  }
+}
+
+// Draws text from the cache, or renders it and keeps the result if it was
+// missed before. False if the caller has to draw it.
+boolean Canvas::drawCachedString(int16_t x, int16_t y, const char *text, uint16_t length, int16_t left, int16_t top,
+                                 uint16_t width, uint16_t height)
+{
+  // the transparent color has to be known to restore what is under a capture
+  if (!textCache.isEnabled() || fontData == nullptr || transparentColor < 0 || color == transparentColor)
+  {
+    return false;
+  }
+  uint32_t key = TextCache::key(fontData, text, length, color, textAlignment);
+  const TextRun *cached = textCache.find(key);
+  if (cached != nullptr)
+  {
+    drawRun(cached, x + cached->dx, y + cached->dy);
+    return true;
+  }
+
+  // runs are captured from the frame buffer, so they have to be on it
+  if (left < 0 || top < 0 || left + width > getWidth() || top + height > getHeight())
+  {
+    return false;
+  }
+  TextRun *run = textCache.insert(key, width, height);
+  if (run == nullptr)
+  {
+    return false;
+  }
+  run->dx = left - x;
+  run->dy = top - y;
+  captureRun(run, x, y, text, length, left, top);
+  return true;
+}
+
+// Renders the text on a background of another color and reads it back. The
+// pixels around the text are saved in the sprite first and restored after.
+void Canvas::captureRun(TextRun *run, int16_t x, int16_t y, const char *text, uint16_t length, int16_t left,
+                        int16_t top)
+{
+  uint8_t background = 0;
+  while (background == color || background == transparentColor)
+  {
+    background++;
+  }
+  run->color = color;
+  run->background = background;
+
+  uint16_t rowBytes = TextCache::rowBytes(run->width);
+  memset(run->pixels, 0, rowBytes * run->height);
+  for (uint16_t row = 0; row < run->height; row++)
+  {
+    uint8_t *bytes = run->pixels + row * rowBytes;
+    for (uint16_t column = 0; column < run->width; column++)
+    {
+      bytes[column / 4] |= (gfx->getPixel(left + column, top + row) & 3) << (6 - (column & 3) * 2);
+    }
+  }
+
+  gfx->setColor(background);
+  gfx->fillRect(left, top, run->width, run->height);
+  gfx->setColor(color);
+  renderString(x, y, text, length);
+
+  // no palette index is transparent while the saved pixels go back
+  gfx->setTransparentColor(0xFFFF);
+  for (uint16_t row = 0; row < run->height; row++)
+  {
+    uint8_t *bytes = run->pixels + row * rowBytes;
+    for (uint16_t column = 0; column < run->width; column++)
+    {
+      uint8_t shift = 6 - (column & 3) * 2;
+      if (gfx->getPixel(left + column, top + row) == color)
+      {
+        bytes[column / 4] = (bytes[column / 4] & ~(3 << shift)) | color << shift;
+        continue;
+      }
+      gfx->setColor(bytes[column / 4] >> shift & 3);
+      gfx->setPixel(left + column, top + row);
+      bytes[column / 4] = (bytes[column / 4] & ~(3 << shift)) | background << shift;
+    }
+  }
+  gfx->setTransparentColor(transparentColor);
+  gfx->setColor(color);
+}
+
+// Draws the text pixels of a run as horizontal spans. Bytes that are all
+// background, four pixels each, are skipped in one step.
+void Canvas::drawRun(const TextRun *run, int16_t left, int16_t top)
+{
+  uint16_t rowBytes = TextCache::rowBytes(run->width);
+  uint8_t blank = run->background * 0x55;
+  gfx->setColor(run->color);
+  for (uint16_t row = 0; row < run->height; row++)
+  {
+    const uint8_t *bytes = run->pixels + row * rowBytes;
+    uint16_t column = 0;
+    while (column < run->width)
+    {
+      if ((column & 3) == 0 && bytes[column / 4] == blank)
+      {
+        column += 4;
+        continue;
+      }
+      if ((bytes[column / 4] >> (6 - (column & 3) * 2) & 3) != run->color)
+      {
+        column++;
+        continue;
+      }
+      uint16_t start = column;
+      while (column < run->width && (bytes[column / 4] >> (6 - (column & 3) * 2) & 3) == run->color)
+      {
+        column++;
+      }
+      gfx->drawHorizontalLine(left + start, top + row, column - start);
+    }
+  }
+}
+
+// Each run is one palette index in the top two bits and the length minus
+// one below, 63 meaning 64 plus the next byte. Runs wrap at the end of a row.
+// Runs of the transparent color only move the position, the others are drawn
+// as horizontal lines.
+void Canvas::drawRleBitmap(uint16_t x, uint16_t y, const char *rleBmp, uint16_t width, uint16_t height)
+{
+  const char *data = rleBmp + 6;
+  uint16_t column = 0;
+  uint16_t row = 0;
+  // in a band the rows above it are only decoded, the ones below not at all
+  int16_t firstRow = bandTop - (int16_t)y;
+  uint16_t endRow = isBanded() ? min((int32_t)height, (int32_t)bandTop + bandHeight - y) : height;
+  while (row < endRow)
+  {
+    uint8_t run = pgm_read_byte(data++);
+    uint8_t index = run >> 6;
+    uint16_t length = (run & 0x3F) + 1;
+    if (length == 64)
+    {
+      length += pgm_read_byte(data++);
+    }
+
+    if (index == transparentColor)
+    {
+      column += length;
+      while (column >= width)
+      {
+        column -= width;
+        row++;
+      }
+      continue;
+    }
+
+    gfx->setColor(ink(index));
+    while (length > 0 && row < endRow)
+    {
+      uint16_t span = min(length, (uint16_t)(width - column));
+      if ((int16_t)row >= firstRow)
+      {
+        gfx->drawHorizontalLine(x + column, y + row - bandTop, span);
+      }
+      length -= span;
+      column += span;
+      if (column == width)
+      {
+        column = 0;
+        row++;
+      }
+    }
+  }
+  gfx->setColor(ink(color));
+}
+
+void Canvas::commit()
+{
+  if (isBanded())
+  {
+    commitBands();
+    return;
+  }
+  if (frameCleared)
+  {
+    diffFrames();
+  }
+  else if (!dirtyRegions.isEmpty())
+  {
+    // the buffer no longer matches the last recorded frame
+    previousValid = false;
+  }
+  frameCleared = false;
+
+  if (dirtyRegions.isEmpty())
+  {
+    return;
+  }
+  gfx->commit();
+  dirtyRegions.clear();
+}
+
+void Canvas::invalidate()
+{
+  previousValid = false;
+  dirtyRegions.invalidate();
+}
+
+void Canvas::setRecording(boolean recording)
+{
+  this->recording = recording;
+}
+
+void Canvas::addDamage(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  dirtyRegions.add(x, y, width, height);
+}
+
+DirtyRegions *Canvas::getDirtyRegions()
+{
+  return &dirtyRegions;
+}
+
+TextCache *Canvas::getTextCache()
+{
+  return &textCache;
+}
+
+void Canvas::setDisplayList(DisplayList *list)
+{
+  displayList = list;
+  if (list != nullptr)
+  {
+    list->setColor(color);
+    list->setTransparentColor(transparentColor);
+    list->setFont(fontData);
+    list->setTextAlignment(textAlignment);
+  }
+}
+
+boolean Canvas::isBanded() const
+{
+  return display != nullptr;
+}
+
+void Canvas::setBandPainter(BandPainter *painter)
+{
+  bandPainter = painter;
+}
+
+// Each damaged band is drawn from scratch, only its damaged parts are sent
+void Canvas::commitBands()
+{
+  if (dirtyRegions.isEmpty())
+  {
+    return;
+  }
+
+  // the rows from the first to the last damaged band are painted once into
+  // the band list, without marking damage, and replayed band by band
+  int16_t first = -1;
+  int16_t end = 0;
+  for (int16_t top = 0; top < getHeight(); top += bandHeight)
+  {
+    if (isBandDamaged(top))
+    {
+      first = first < 0 ? top : first;
+      end = top + bandHeight;
+    }
+  }
+  boolean replay = false;
+  if (bandPainter != nullptr)
+  {
+    DisplayList *attached = displayList;
+    boolean wasRecording = recording;
+    recording = false;
+    bandList.clear();
+    setDisplayList(&bandList);
+    bandPainter->paintBand(this, first, end - first);
+    displayList = attached;
+    recording = wasRecording;
+    // too much for the list, the painter draws every band itself
+    replay = !bandList.hasOverflowed();
+  }
+
+  drawing = true;
+  for (bandTop = first; bandTop < end; bandTop += bandHeight)
+  {
+    if (!isBandDamaged(bandTop))
+    {
+      continue;
+    }
+    clearBand(background);
+    if (replay)
+    {
+      bandList.replay(this, 0, bandTop, getWidth(), bandHeight);
+    }
+    else if (bandPainter != nullptr)
+    {
+      bandPainter->paintBand(this, bandTop, bandHeight);
+    }
+    gfx->commit(0, bandTop);
+  }
+  drawing = false;
+  bandTop = 0;
+  dirtyRegions.clear();
+}
+
+void Canvas::clearBand(uint8_t pal)
+{
+  gfx->setColor(ink(pal));
+  gfx->fillRect(0, 0, getWidth(), bandHeight);
+  gfx->setColor(ink(color));
+}
+
+boolean Canvas::isBandDamaged(int16_t top)
+{
+  if (dirtyRegions.isFull())
+  {
+    return true;
+  }
+  for (uint8_t i = 0; i < dirtyRegions.count(); i++)
+  {
+    const DirtyRect &rect = dirtyRegions.get(i);
+    if (rect.y0 < top + bandHeight && rect.y1 > top)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+boolean Canvas::overlapsBand(int16_t y, int16_t height)
+{
+  return y < bandTop + bandHeight && y + height > bandTop;
+}
+
+void Canvas::fillBandRect(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  int16_t top = max(y, bandTop);
+  int16_t bottom = min((int16_t)(y + height), (int16_t)(bandTop + bandHeight));
+  if (width > 0 && top < bottom)
+  {
+    gfx->fillRect(x, top - bandTop, width, bottom - top);
+  }
+}
+
+// The list draw calls go to, none while bands are drawn
+DisplayList *Canvas::listing()
+{
+  return drawing ? nullptr : displayList;
+}
+
+// Palette index to the color of a banded canvas
+uint16_t Canvas::ink(uint16_t color)
+{
+  return isBanded() && color < colors ? palette[color] : color;
+}
+
+void Canvas::record(uint32_t hash, int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  // bands draw what was marked before
+  if (!recording || drawing)
+  {
+    return;
+  }
+  if (!frameCleared || isBanded())
+  {
+    dirtyRegions.add(x, y, width, height);
+    return;
+  }
+  if (currentCount == CANVAS_MAX_OPERATIONS)
+  {
+    overflow = true;
+    return;
+  }
+  // rectangles entirely outside the frame are dropped
+  Operation &operation = current[currentCount];
+  if (dirtyRegions.clip(x, y, width, height, operation.rect))
+  {
+    operation.hash = hash;
+    currentCount++;
+  }
+}
+
+// Damage is everything drawn now that was not drawn last time and the other
+// way round. Calls that match one of the previous frame left identical pixels.
+void Canvas::diffFrames()
+{
+  if (!previousValid || overflow)
+  {
+    dirtyRegions.invalidate();
+  }
+  else
+  {
+    for (uint8_t i = 0; i < currentCount; i++)
+    {
+      if (!contains(previous, previousCount, current[i]))
+      {
+        dirtyRegions.add(current[i].rect);
+      }
+    }
+    for (uint8_t i = 0; i < previousCount; i++)
+    {
+      if (!contains(current, currentCount, previous[i]))
+      {
+        dirtyRegions.add(previous[i].rect);
+      }
+    }
+  }
+
+  Operation *swap = previous;
+  previous = current;
+  current = swap;
+  previousCount = currentCount;
+  previousValid = !overflow;
+  currentCount = 0;
+}
+
+boolean Canvas::contains(const Operation *operations, uint8_t count, const Operation &operation)
+{
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (operations[i].hash == operation.hash &&
+        memcmp(&operations[i].rect, &operation.rect, sizeof(DirtyRect)) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// FNV-1a
+uint32_t Canvas::hashBytes(uint32_t hash, const void *data, size_t length)
+{
+  const uint8_t *bytes = (const uint8_t *)data;
+  while (length--)
+  {
+    hash = (hash ^ *bytes++) * 16777619;
+  }
+  return hash;
+}
+
+// Hash of a draw call including the drawing state it depends on
+uint32_t Canvas::hashCall(uint8_t call, const void *data, size_t length)
+{
+  uint32_t hash = hashBytes(2166136261, &call, sizeof(call));
+  hash = hashBytes(hash, &color, sizeof(color));
+  hash = hashBytes(hash, &transparentColor, sizeof(transparentColor));
+  hash = hashBytes(hash, &fontData, sizeof(fontData));
+  hash = hashBytes(hash, &textAlignment, sizeof(textAlignment));
+  return hashBytes(hash, data, length);
+}
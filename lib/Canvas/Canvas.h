@@ -0,0 +1,155 @@
+#ifndef _CANVAS_H_
+#define _CANVAS_H_
+
+#include <MiniGrafx.h>
+#include <DirtyRegions.h>
+#include "TextCache.h"
+#include "DisplayList.h"
+
+// Number of draw calls remembered per frame for change detection
+#ifndef CANVAS_MAX_OPERATIONS
+#define CANVAS_MAX_OPERATIONS 96
+#endif
+
+// Longest text drawn without a heap copy, longer text goes through
+// MiniGrafx::drawString()
+#ifndef CANVAS_MAX_TEXT_LENGTH
+#define CANVAS_MAX_TEXT_LENGTH 128
+#endif
+
+// Version byte of run length encoded paletted bitmaps, see
+// tools/compress_icons.py. Other versions are drawn by MiniGrafx.
+#define CANVAS_RLE_BITMAP_VERSION 0x81
+
+class Canvas;
+
+// Draws everything that shows in a band of a banded canvas
+class BandPainter
+{
+public:
+  virtual ~BandPainter() {}
+  virtual void paintBand(Canvas *canvas, int16_t top, uint16_t height) = 0;
+};
+
+// Forwards drawing to MiniGrafx and records which parts of the frame buffer
+// each call touched, so a commit only has to flush what changed.
+//
+// A frame that starts with fillBuffer() is redrawn from scratch. Its draw
+// calls are compared with those of the previous such frame and only calls
+// that differ (by bounds, parameters and drawing state) count as damage.
+// Any draw call on a frame that was not cleared counts as damage directly.
+//
+// A banded canvas keeps no frame at all. Draw calls only mark damage, and a
+// commit clears each damaged band, has the band painter draw it again and
+// flushes it on its own. The painter draws once into a display list, and
+// each band replays the commands that overlap it.
+class Canvas
+{
+public:
+  Canvas(MiniGrafx *gfx);
+  // Banded: gfx holds one band in 16 bit color, as wide as the display in
+  // its rotation. Colors stay palette indices and are looked up on the way.
+  Canvas(MiniGrafx *band, DisplayDriver *display, const uint16_t *palette, uint8_t colors);
+
+  void init();
+  void setRotation(uint8_t r);
+  uint16_t getWidth();
+  uint16_t getHeight();
+
+  void setColor(uint16_t color);
+  void setTransparentColor(uint16_t transparentColor);
+  // -1 if no palette index is transparent
+  int16_t getTransparentColor();
+  void setFont(const char *fontData);
+  void setTextAlignment(TEXT_ALIGNMENT textAlignment);
+
+  void fillBuffer(uint8_t pal);
+  void setPixel(uint16_t x, uint16_t y);
+  void drawRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+  void fillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+  void fillCircle(uint16_t x0, uint16_t y0, uint16_t radius);
+  void drawString(int16_t x, int16_t y, const char *text);
+  void drawString(int16_t x, int16_t y, const String &text);
+  uint16_t drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, String text);
+  void drawPalettedBitmapFromPgm(uint16_t x, uint16_t y, const char *palBmp);
+  uint16_t getStringWidth(const char *text, uint16_t length);
+
+  // Flushes the damaged regions, does nothing if nothing changed
+  void commit();
+  // Makes the next commit flush the whole frame
+  void invalidate();
+  // While off, draw calls change the buffer without marking damage, for
+  // content that is flushed later through addDamage()
+  void setRecording(boolean recording);
+  // Flushes the area with the next commit, whatever was drawn there
+  void addDamage(int16_t x, int16_t y, int16_t width, int16_t height);
+  DirtyRegions *getDirtyRegions();
+  TextCache *getTextCache();
+  // While set, draw calls and changes of the drawing state also go into the
+  // list, starting with the current drawing state. nullptr stops recording.
+  void setDisplayList(DisplayList *list);
+
+  boolean isBanded() const;
+  // Draws the bands at the next commit, the background is the color of the
+  // last fillBuffer()
+  void setBandPainter(BandPainter *painter);
+
+private:
+  struct Operation
+  {
+    uint32_t hash;
+    DirtyRect rect;
+  };
+
+  void renderString(int16_t x, int16_t y, const char *text, uint16_t length);
+  boolean drawCachedString(int16_t x, int16_t y, const char *text, uint16_t length, int16_t left, int16_t top,
+                           uint16_t width, uint16_t height);
+  void captureRun(TextRun *run, int16_t x, int16_t y, const char *text, uint16_t length, int16_t left, int16_t top);
+  void drawRun(const TextRun *run, int16_t left, int16_t top);
+  void drawRleBitmap(uint16_t x, uint16_t y, const char *rleBmp, uint16_t width, uint16_t height);
+  void record(uint32_t hash, int16_t x, int16_t y, int16_t width, int16_t height);
+  void commitBands();
+  boolean isBandDamaged(int16_t top);
+  boolean overlapsBand(int16_t y, int16_t height);
+  void clearBand(uint8_t pal);
+  void fillBandRect(int16_t x, int16_t y, int16_t width, int16_t height);
+  uint16_t ink(uint16_t color);
+  DisplayList *listing();
+  void diffFrames();
+  static boolean contains(const Operation *operations, uint8_t count, const Operation &operation);
+  static uint32_t hashBytes(uint32_t hash, const void *data, size_t length);
+  uint32_t hashCall(uint8_t call, const void *data, size_t length);
+
+  MiniGrafx *gfx;
+  // banded canvases only
+  DisplayDriver *display = nullptr;
+  const uint16_t *palette = nullptr;
+  uint8_t colors = 0;
+  uint16_t bandHeight = 0;
+  int16_t bandTop = 0;
+  // true while the band painter draws
+  boolean drawing = false;
+  uint8_t background = 0;
+  BandPainter *bandPainter = nullptr;
+  DisplayList bandList;
+  DirtyRegions dirtyRegions;
+  TextCache textCache;
+  DisplayList *displayList = nullptr;
+
+  const char *fontData = nullptr;
+  TEXT_ALIGNMENT textAlignment = TEXT_ALIGN_LEFT;
+
+  boolean recording = true;
+  boolean frameCleared = false;
+  boolean previousValid = false;
+  boolean overflow = false;
+  uint8_t currentCount = 0;
+  uint8_t previousCount = 0;
+  Operation operations[2][CANVAS_MAX_OPERATIONS];
+  Operation *current = operations[0];
+  Operation *previous = operations[1];
+  uint16_t color = 0;
+  int16_t transparentColor = -1;
+};
+
+#endif
@@ -0,0 +1,344 @@
+#include "DisplayList.h"
+#include "Canvas.h"
+
+enum KnownState
+{
+  KNOWN_COLOR = 1,
+  KNOWN_TRANSPARENT_COLOR = 2,
+  KNOWN_FONT = 4,
+  KNOWN_TEXT_ALIGNMENT = 8
+};
+
+DisplayList::DisplayList(size_t capacity)
+{
+  this->capacity = capacity;
+}
+
+DisplayList::~DisplayList()
+{
+  free(buffer);
+}
+
+void DisplayList::clear()
+{
+  used = 0;
+  commands = 0;
+  overflow = false;
+  known = 0;
+}
+
+boolean DisplayList::hasOverflowed() const
+{
+  return overflow;
+}
+
+size_t DisplayList::size() const
+{
+  return used;
+}
+
+uint16_t DisplayList::count() const
+{
+  return commands;
+}
+
+const uint8_t *DisplayList::data() const
+{
+  return buffer;
+}
+
+void DisplayList::setColor(uint16_t color)
+{
+  if ((known & KNOWN_COLOR) && this->color == color)
+  {
+    return;
+  }
+  if (begin(OP_SET_COLOR, sizeof(color)))
+  {
+    put(&color, sizeof(color));
+    this->color = color;
+    known |= KNOWN_COLOR;
+  }
+}
+
+// -1 is no transparency, widgets switch to it to fill their background
+void DisplayList::setTransparentColor(int16_t transparentColor)
+{
+  if ((known & KNOWN_TRANSPARENT_COLOR) && this->transparentColor == transparentColor)
+  {
+    return;
+  }
+  if (begin(OP_SET_TRANSPARENT_COLOR, sizeof(transparentColor)))
+  {
+    put(&transparentColor, sizeof(transparentColor));
+    this->transparentColor = transparentColor;
+    known |= KNOWN_TRANSPARENT_COLOR;
+  }
+}
+
+void DisplayList::setFont(const char *fontData)
+{
+  if (fontData == nullptr || ((known & KNOWN_FONT) && this->fontData == fontData))
+  {
+    return;
+  }
+  if (begin(OP_SET_FONT, sizeof(fontData)))
+  {
+    put(&fontData, sizeof(fontData));
+    this->fontData = fontData;
+    known |= KNOWN_FONT;
+  }
+}
+
+void DisplayList::setTextAlignment(TEXT_ALIGNMENT textAlignment)
+{
+  if ((known & KNOWN_TEXT_ALIGNMENT) && this->textAlignment == textAlignment)
+  {
+    return;
+  }
+  uint8_t alignment = textAlignment;
+  if (begin(OP_SET_TEXT_ALIGNMENT, sizeof(alignment)))
+  {
+    put(&alignment, sizeof(alignment));
+    this->textAlignment = textAlignment;
+    known |= KNOWN_TEXT_ALIGNMENT;
+  }
+}
+
+void DisplayList::fillBuffer(uint8_t pal, uint16_t width, uint16_t height)
+{
+  if (beginDraw(OP_FILL_BUFFER, 0, 0, width, height, sizeof(pal)))
+  {
+    put(&pal, sizeof(pal));
+  }
+}
+
+// the bounds of pixels, rectangles and circles are all their arguments
+void DisplayList::setPixel(uint16_t x, uint16_t y)
+{
+  beginDraw(OP_SET_PIXEL, x, y, 1, 1, 0);
+}
+
+void DisplayList::drawRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  beginDraw(OP_DRAW_RECT, x, y, width, height, 0);
+}
+
+void DisplayList::fillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  beginDraw(OP_FILL_RECT, x, y, width, height, 0);
+}
+
+void DisplayList::fillCircle(uint16_t x0, uint16_t y0, uint16_t radius)
+{
+  beginDraw(OP_FILL_CIRCLE, x0 - radius, y0 - radius, 2 * radius + 1, 2 * radius + 1, 0);
+}
+
+void DisplayList::drawString(int16_t x, int16_t y, const char *text, uint16_t length, int16_t left, int16_t top,
+                             uint16_t width, uint16_t height)
+{
+  int16_t args[] = {x, y};
+  if (beginDraw(OP_DRAW_STRING, left, top, width, height, sizeof(args) + length + 1))
+  {
+    put(args, sizeof(args));
+    put(text, length);
+    put("", 1);
+  }
+}
+
+void DisplayList::drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char *text, uint16_t length,
+                                     int16_t left, int16_t top, uint16_t width, uint16_t height)
+{
+  int16_t args[] = {x, y, (int16_t)maxLineWidth};
+  if (beginDraw(OP_DRAW_STRING_MAX_WIDTH, left, top, width, height, sizeof(args) + length + 1))
+  {
+    put(args, sizeof(args));
+    put(text, length);
+    put("", 1);
+  }
+}
+
+void DisplayList::drawPalettedBitmapFromPgm(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                            const char *palBmp)
+{
+  if (beginDraw(OP_DRAW_PALETTED_BITMAP, x, y, width, height, sizeof(palBmp)))
+  {
+    put(&palBmp, sizeof(palBmp));
+  }
+}
+
+uint16_t DisplayList::replay(Canvas *canvas) const
+{
+  return replay(canvas, nullptr);
+}
+
+uint16_t DisplayList::replay(Canvas *canvas, int16_t x, int16_t y, uint16_t width, uint16_t height) const
+{
+  Bounds clip = {x, y, width, height};
+  return replay(canvas, &clip);
+}
+
+// Arguments are read with memcpy(), commands are packed without alignment
+uint16_t DisplayList::replay(Canvas *canvas, const Bounds *clip) const
+{
+  uint16_t drawn = 0;
+  const uint8_t *command = buffer;
+  const uint8_t *end = buffer + used;
+  while (command < end)
+  {
+    uint8_t opcode = *command++;
+    Bounds bounds;
+    if (opcode >= OP_FILL_BUFFER)
+    {
+      memcpy(&bounds, command, sizeof(bounds));
+      command += sizeof(bounds);
+    }
+    boolean skip = opcode >= OP_FILL_BUFFER && clip != nullptr &&
+                   !(bounds.x < clip->x + clip->width && clip->x < bounds.x + bounds.width &&
+                     bounds.y < clip->y + clip->height && clip->y < bounds.y + bounds.height);
+    drawn += opcode >= OP_FILL_BUFFER && !skip;
+
+    switch (opcode)
+    {
+    case OP_SET_COLOR:
+    {
+      uint16_t color;
+      memcpy(&color, command, sizeof(color));
+      command += sizeof(color);
+      canvas->setColor(color);
+      break;
+    }
+    case OP_SET_TRANSPARENT_COLOR:
+    {
+      int16_t transparentColor;
+      memcpy(&transparentColor, command, sizeof(transparentColor));
+      command += sizeof(transparentColor);
+      canvas->setTransparentColor(transparentColor < 0 ? 0xFFFF : transparentColor);
+      break;
+    }
+    case OP_SET_FONT:
+    {
+      const char *fontData;
+      memcpy(&fontData, command, sizeof(fontData));
+      command += sizeof(fontData);
+      canvas->setFont(fontData);
+      break;
+    }
+    case OP_SET_TEXT_ALIGNMENT:
+      canvas->setTextAlignment((TEXT_ALIGNMENT)*command++);
+      break;
+    case OP_FILL_BUFFER:
+      if (!skip)
+      {
+        canvas->fillBuffer(*command);
+      }
+      command++;
+      break;
+    case OP_SET_PIXEL:
+      if (!skip)
+      {
+        canvas->setPixel(bounds.x, bounds.y);
+      }
+      break;
+    case OP_DRAW_RECT:
+      if (!skip)
+      {
+        canvas->drawRect(bounds.x, bounds.y, bounds.width, bounds.height);
+      }
+      break;
+    case OP_FILL_RECT:
+      if (!skip)
+      {
+        canvas->fillRect(bounds.x, bounds.y, bounds.width, bounds.height);
+      }
+      break;
+    case OP_FILL_CIRCLE:
+      if (!skip)
+      {
+        uint16_t radius = (bounds.width - 1) / 2;
+        canvas->fillCircle(bounds.x + radius, bounds.y + radius, radius);
+      }
+      break;
+    case OP_DRAW_STRING:
+    {
+      int16_t args[2];
+      memcpy(args, command, sizeof(args));
+      command += sizeof(args);
+      const char *text = (const char *)command;
+      command += strlen(text) + 1;
+      if (!skip)
+      {
+        canvas->drawString(args[0], args[1], text);
+      }
+      break;
+    }
+    case OP_DRAW_STRING_MAX_WIDTH:
+    {
+      int16_t args[3];
+      memcpy(args, command, sizeof(args));
+      command += sizeof(args);
+      const char *text = (const char *)command;
+      command += strlen(text) + 1;
+      if (!skip)
+      {
+        canvas->drawStringMaxWidth(args[0], args[1], args[2], text);
+      }
+      break;
+    }
+    case OP_DRAW_PALETTED_BITMAP:
+    {
+      const char *palBmp;
+      memcpy(&palBmp, command, sizeof(palBmp));
+      command += sizeof(palBmp);
+      if (!skip)
+      {
+        canvas->drawPalettedBitmapFromPgm(bounds.x, bounds.y, palBmp);
+      }
+      break;
+    }
+    default:
+      // not written by this version, the rest cannot be decoded
+      return drawn;
+    }
+  }
+  return drawn;
+}
+
+// Reserves a whole command or nothing, so a full list still replays
+boolean DisplayList::begin(uint8_t opcode, size_t length)
+{
+  if (overflow || used + 1 + length > capacity)
+  {
+    overflow = true;
+    return false;
+  }
+  if (buffer == nullptr)
+  {
+    buffer = (uint8_t *)malloc(capacity);
+    if (buffer == nullptr)
+    {
+      overflow = true;
+      return false;
+    }
+  }
+  buffer[used++] = opcode;
+  commands++;
+  return true;
+}
+
+boolean DisplayList::beginDraw(uint8_t opcode, int16_t x, int16_t y, uint16_t width, uint16_t height, size_t length)
+{
+  Bounds bounds = {x, y, width, height};
+  if (!begin(opcode, sizeof(bounds) + length))
+  {
+    return false;
+  }
+  put(&bounds, sizeof(bounds));
+  return true;
+}
+
+void DisplayList::put(const void *data, size_t length)
+{
+  memcpy(buffer + used, data, length);
+  used += length;
+}
@@ -0,0 +1,106 @@
+#ifndef _DISPLAY_LIST_H_
+#define _DISPLAY_LIST_H_
+
+#include <MiniGrafx.h>
+
+// Bytes of commands kept at most
+#ifndef DISPLAY_LIST_BYTES
+#ifdef ESP32
+#define DISPLAY_LIST_BYTES 8192
+#else
+#define DISPLAY_LIST_BYTES 3072
+#endif
+#endif
+
+class Canvas;
+
+// Draw calls of a Canvas in a compact binary form, to be replayed later on
+// the same or another canvas.
+//
+// A command is an opcode byte followed by its arguments in native byte
+// order. Draw commands start with their bounds (x, y, width, height), so a
+// replay skips those outside its clip without decoding the rest. Text is
+// stored with its terminating zero, fonts and bitmaps by address, so a list
+// only replays within the firmware that recorded it. Changes of the drawing
+// state are only stored when they change something.
+//
+// The buffer is allocated with the first command and kept. Commands that do
+// not fit any more are dropped and mark the list as overflowed.
+class DisplayList
+{
+public:
+  DisplayList(size_t capacity = DISPLAY_LIST_BYTES);
+  ~DisplayList();
+
+  void clear();
+  boolean hasOverflowed() const;
+  size_t size() const;
+  uint16_t count() const;
+  const uint8_t *data() const;
+
+  void setColor(uint16_t color);
+  void setTransparentColor(int16_t transparentColor);
+  void setFont(const char *fontData);
+  void setTextAlignment(TEXT_ALIGNMENT textAlignment);
+  void fillBuffer(uint8_t pal, uint16_t width, uint16_t height);
+  void setPixel(uint16_t x, uint16_t y);
+  void drawRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+  void fillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+  void fillCircle(uint16_t x0, uint16_t y0, uint16_t radius);
+  // The bounds are the ones Canvas estimated for the text
+  void drawString(int16_t x, int16_t y, const char *text, uint16_t length, int16_t left, int16_t top,
+                  uint16_t width, uint16_t height);
+  void drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char *text, uint16_t length,
+                          int16_t left, int16_t top, uint16_t width, uint16_t height);
+  void drawPalettedBitmapFromPgm(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const char *palBmp);
+
+  // Replays every command, returns the number of draw commands replayed
+  uint16_t replay(Canvas *canvas) const;
+  // Replays the drawing state and the draw commands whose bounds overlap the
+  // rectangle. Those are drawn whole, only a banded canvas clips them to the
+  // band it draws.
+  uint16_t replay(Canvas *canvas, int16_t x, int16_t y, uint16_t width, uint16_t height) const;
+
+private:
+  enum Opcode : uint8_t
+  {
+    OP_SET_COLOR,
+    OP_SET_TRANSPARENT_COLOR,
+    OP_SET_FONT,
+    OP_SET_TEXT_ALIGNMENT,
+    OP_FILL_BUFFER,
+    OP_SET_PIXEL,
+    OP_DRAW_RECT,
+    OP_FILL_RECT,
+    OP_FILL_CIRCLE,
+    OP_DRAW_STRING,
+    OP_DRAW_STRING_MAX_WIDTH,
+    OP_DRAW_PALETTED_BITMAP
+  };
+
+  struct Bounds
+  {
+    int16_t x, y;
+    uint16_t width, height;
+  };
+
+  boolean begin(uint8_t opcode, size_t length);
+  boolean beginDraw(uint8_t opcode, int16_t x, int16_t y, uint16_t width, uint16_t height, size_t length);
+  void put(const void *data, size_t length);
+  uint16_t replay(Canvas *canvas, const Bounds *clip) const;
+
+  size_t capacity;
+  uint8_t *buffer = nullptr;
+  size_t used = 0;
+  uint16_t commands = 0;
+  boolean overflow = false;
+
+  // drawing state as of the end of the list, to drop commands that keep it
+  uint8_t known = 0;
+  uint16_t color = 0;
+  int16_t transparentColor = -1;
+  const char *fontData = nullptr;
+  TEXT_ALIGNMENT textAlignment = TEXT_ALIGN_LEFT;
+};
+
+#endif
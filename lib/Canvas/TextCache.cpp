@@ -0,0 +1,164 @@
+#include "TextCache.h"
+
+TextCache::TextCache(size_t budget)
+{
+  this->budget = budget;
+  memset(counters, 0, sizeof(counters));
+}
+
+TextCache::~TextCache()
+{
+  free(pool);
+}
+
+// FNV-1a over everything that changes the sprite
+uint32_t TextCache::key(const char *font, const char *text, uint16_t length, uint16_t color, uint8_t alignment)
+{
+  uint32_t hash = 2166136261;
+  const uint8_t *parts[] = {(const uint8_t *)&font, (const uint8_t *)&color, &alignment, (const uint8_t *)&length};
+  const size_t sizes[] = {sizeof(font), sizeof(color), sizeof(alignment), sizeof(length)};
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    for (size_t j = 0; j < sizes[i]; j++)
+    {
+      hash = (hash ^ parts[i][j]) * 16777619;
+    }
+  }
+  for (uint16_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ (uint8_t)text[i]) * 16777619;
+  }
+  return hash;
+}
+
+uint16_t TextCache::rowBytes(uint16_t width)
+{
+  return (width + 3) / 4;
+}
+
+boolean TextCache::isEnabled() const
+{
+  return budget > 0;
+}
+
+const TextRun *TextCache::find(uint32_t key)
+{
+  uint8_t &count = frequency(key);
+  if (count < 255)
+  {
+    count++;
+  }
+  // halving now and then lets runs that are no longer shown fade out
+  if (++requests == TEXT_CACHE_COUNTERS * 8)
+  {
+    requests = 0;
+    for (uint16_t i = 0; i < TEXT_CACHE_COUNTERS; i++)
+    {
+      counters[i] >>= 1;
+    }
+  }
+
+  for (uint8_t i = 0; i < runCount; i++)
+  {
+    if (runs[i].key == key)
+    {
+      runs[i].lastUse = ++clock;
+      hits++;
+      return &runs[i];
+    }
+  }
+  misses++;
+  return nullptr;
+}
+
+TextRun *TextCache::insert(uint32_t key, uint16_t width, uint16_t height)
+{
+  size_t size = (size_t)rowBytes(width) * height;
+  uint8_t count = frequency(key);
+  if (size == 0 || size > budget || count < 2)
+  {
+    return nullptr;
+  }
+  while (runCount > 0 && (runCount == TEXT_CACHE_RUNS || bytesUsed + size > budget))
+  {
+    uint8_t oldest = 0;
+    for (uint8_t i = 1; i < runCount; i++)
+    {
+      if (runs[i].lastUse < runs[oldest].lastUse)
+      {
+        oldest = i;
+      }
+    }
+    if (frequency(runs[oldest].key) >= count)
+    {
+      return nullptr;
+    }
+    evict(oldest);
+  }
+
+  if (pool == nullptr)
+  {
+    pool = (uint8_t *)malloc(budget);
+    if (pool == nullptr)
+    {
+      return nullptr;
+    }
+  }
+  TextRun &run = runs[runCount++];
+  run.key = key;
+  run.width = width;
+  run.height = height;
+  run.lastUse = ++clock;
+  run.pixels = pool + bytesUsed;
+  bytesUsed += size;
+  return &run;
+}
+
+void TextCache::clear()
+{
+  while (runCount > 0)
+  {
+    evict(runCount - 1);
+  }
+}
+
+uint32_t TextCache::getHits() const
+{
+  return hits;
+}
+
+uint32_t TextCache::getMisses() const
+{
+  return misses;
+}
+
+size_t TextCache::getBytesUsed() const
+{
+  return bytesUsed;
+}
+
+uint8_t TextCache::count() const
+{
+  return runCount;
+}
+
+uint8_t &TextCache::frequency(uint32_t key)
+{
+  return counters[(key ^ key >> 16) & (TEXT_CACHE_COUNTERS - 1)];
+}
+
+// Runs are packed in the order of the array, the ones after the evicted run
+// move down to close the gap
+void TextCache::evict(uint8_t index)
+{
+  size_t size = (size_t)rowBytes(runs[index].width) * runs[index].height;
+  uint8_t *end = runs[index].pixels + size;
+  memmove(runs[index].pixels, end, pool + bytesUsed - end);
+  bytesUsed -= size;
+  for (uint8_t i = index + 1; i < runCount; i++)
+  {
+    runs[i].pixels -= size;
+    runs[i - 1] = runs[i];
+  }
+  runCount--;
+}
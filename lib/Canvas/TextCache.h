@@ -0,0 +1,87 @@
+#ifndef _TEXT_CACHE_H_
+#define _TEXT_CACHE_H_
+
+#include <Arduino.h>
+
+// Bytes of sprites kept at most, 0 turns the cache off
+#ifndef TEXT_CACHE_BYTES
+#ifdef ESP32
+#define TEXT_CACHE_BYTES 8192
+#else
+#define TEXT_CACHE_BYTES 2048
+#endif
+#endif
+
+// Number of runs kept at most
+#ifndef TEXT_CACHE_RUNS
+#ifdef ESP32
+#define TEXT_CACHE_RUNS 48
+#else
+#define TEXT_CACHE_RUNS 16
+#endif
+#endif
+
+// Counters estimating how often each run is requested, a power of two
+#ifndef TEXT_CACHE_COUNTERS
+#define TEXT_CACHE_COUNTERS 128
+#endif
+
+// Rendered text, a packed 2 bit sprite of its bounds. Pixels of the text hold
+// its color, all others the background index.
+struct TextRun
+{
+  uint32_t key;
+  int16_t dx, dy;
+  uint16_t width, height;
+  uint8_t color, background;
+  uint32_t lastUse;
+  uint8_t *pixels;
+};
+
+// Least recently used text runs within a byte budget. A run is only stored
+// once it was requested before, and only replaces the least recently used
+// run if it is requested more often. Text that keeps changing like the clock
+// never gets in, and screens with more text than fits keep a stable part
+// of it instead of replacing every run once per round.
+//
+// The runs share one block of the budget's size, allocated with the first
+// run and kept, so the heap does not churn as runs come and go.
+class TextCache
+{
+public:
+  TextCache(size_t budget = TEXT_CACHE_BYTES);
+  ~TextCache();
+
+  static uint32_t key(const char *font, const char *text, uint16_t length, uint16_t color, uint8_t alignment);
+  static uint16_t rowBytes(uint16_t width);
+
+  boolean isEnabled() const;
+  // The run for a key, nullptr counts as a miss
+  const TextRun *find(uint32_t key);
+  // Reserves a run for a missed key, dropping less used ones to make room.
+  // nullptr if the key is not worth it or the run does not fit.
+  TextRun *insert(uint32_t key, uint16_t width, uint16_t height);
+  void clear();
+
+  uint32_t getHits() const;
+  uint32_t getMisses() const;
+  size_t getBytesUsed() const;
+  uint8_t count() const;
+
+private:
+  uint8_t &frequency(uint32_t key);
+  void evict(uint8_t index);
+
+  size_t budget;
+  uint8_t *pool = nullptr;
+  size_t bytesUsed = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+  uint32_t clock = 0;
+  uint8_t runCount = 0;
+  TextRun runs[TEXT_CACHE_RUNS];
+  uint8_t counters[TEXT_CACHE_COUNTERS];
+  uint16_t requests = 0;
+};
+
+#endif
@@ -0,0 +1,155 @@
+#include "DirtyRegions.h"
+
+DirtyRegions::DirtyRegions(uint16_t width, uint16_t height)
+{
+  setBounds(width, height);
+}
+
+void DirtyRegions::setBounds(uint16_t width, uint16_t height)
+{
+  this->width = width;
+  this->height = height;
+  invalidate();
+}
+
+void DirtyRegions::add(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  DirtyRect rect;
+  if (clip(x, y, width, height, rect))
+  {
+    add(rect);
+  }
+}
+
+boolean DirtyRegions::clip(int16_t x, int16_t y, int16_t width, int16_t height, DirtyRect &rect) const
+{
+  int32_t x0 = max((int32_t)x, (int32_t)0);
+  int32_t y0 = max((int32_t)y, (int32_t)0);
+  int32_t x1 = min((int32_t)x + width, (int32_t)this->width);
+  int32_t y1 = min((int32_t)y + height, (int32_t)this->height);
+  if (x0 >= x1 || y0 >= y1)
+  {
+    return false;
+  }
+  rect = {(uint16_t)x0, (uint16_t)y0, (uint16_t)x1, (uint16_t)y1};
+  return true;
+}
+
+void DirtyRegions::add(const DirtyRect &rect)
+{
+  if (full)
+  {
+    return;
+  }
+
+  // absorb every rectangle that is cheap to merge with, the union may reach
+  // further so start over after each merge
+  DirtyRect merged = rect;
+  uint8_t i = 0;
+  while (i < rectCount)
+  {
+    if (mergeCost(merged, rects[i]) <= DIRTY_REGIONS_MERGE_SLACK)
+    {
+      merged = unite(merged, rects[i]);
+      rects[i] = rects[--rectCount];
+      i = 0;
+    }
+    else
+    {
+      i++;
+    }
+  }
+  rects[rectCount++] = merged;
+  if (rectCount > DIRTY_REGIONS_MAX)
+  {
+    mergeCheapestPair();
+  }
+
+  // past this point a single window is cheaper than several
+  if (area() > (uint32_t)width * height * 3 / 4)
+  {
+    invalidate();
+  }
+}
+
+void DirtyRegions::invalidate()
+{
+  full = true;
+  rectCount = 1;
+  rects[0] = {0, 0, width, height};
+}
+
+void DirtyRegions::clear()
+{
+  full = false;
+  rectCount = 0;
+}
+
+boolean DirtyRegions::isEmpty() const
+{
+  return rectCount == 0;
+}
+
+boolean DirtyRegions::isFull() const
+{
+  return full;
+}
+
+uint8_t DirtyRegions::count() const
+{
+  return rectCount;
+}
+
+const DirtyRect &DirtyRegions::get(uint8_t index) const
+{
+  return rects[index];
+}
+
+uint32_t DirtyRegions::area() const
+{
+  uint32_t sum = 0;
+  for (uint8_t i = 0; i < rectCount; i++)
+  {
+    sum += areaOf(rects[i]);
+  }
+  return sum;
+}
+
+uint32_t DirtyRegions::areaOf(const DirtyRect &rect)
+{
+  return (uint32_t)(rect.x1 - rect.x0) * (rect.y1 - rect.y0);
+}
+
+DirtyRect DirtyRegions::unite(const DirtyRect &a, const DirtyRect &b)
+{
+  return {min(a.x0, b.x0), min(a.y0, b.y0), max(a.x1, b.x1), max(a.y1, b.y1)};
+}
+
+// Pixels the union of both rectangles covers that none of them does
+uint32_t DirtyRegions::mergeCost(const DirtyRect &a, const DirtyRect &b)
+{
+  uint32_t covered = areaOf(a) + areaOf(b);
+  uint32_t united = areaOf(unite(a, b));
+  return united > covered ? united - covered : 0;
+}
+
+void DirtyRegions::mergeCheapestPair()
+{
+  uint8_t bestA = 0, bestB = 1;
+  uint32_t bestCost = UINT32_MAX;
+  for (uint8_t a = 0; a < rectCount; a++)
+  {
+    for (uint8_t b = a + 1; b < rectCount; b++)
+    {
+      uint32_t cost = mergeCost(rects[a], rects[b]);
+      if (cost < bestCost)
+      {
+        bestCost = cost;
+        bestA = a;
+        bestB = b;
+      }
+    }
+  }
+  rects[bestA] = unite(rects[bestA], rects[bestB]);
+  rects[bestB] = rects[--rectCount];
+}
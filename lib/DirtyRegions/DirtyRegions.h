@@ -0,0 +1,57 @@
+#ifndef _DIRTY_REGIONS_H_
+#define _DIRTY_REGIONS_H_
+
+#include <Arduino.h>
+
+// Maximum number of separate rectangles before neighbours get merged
+#ifndef DIRTY_REGIONS_MAX
+#define DIRTY_REGIONS_MAX 8
+#endif
+
+// Two rectangles are merged if their union covers at most this many pixels
+// that neither of them needed. Roughly what one extra address window costs.
+#ifndef DIRTY_REGIONS_MERGE_SLACK
+#define DIRTY_REGIONS_MERGE_SLACK 256
+#endif
+
+// Rectangle with exclusive right and bottom edges
+struct DirtyRect
+{
+  uint16_t x0, y0, x1, y1;
+};
+
+// Collects the damaged areas of a frame, coalesced into a few rectangles
+class DirtyRegions
+{
+public:
+  DirtyRegions(uint16_t width, uint16_t height);
+
+  void setBounds(uint16_t width, uint16_t height);
+  void add(int16_t x, int16_t y, int16_t width, int16_t height);
+  void add(const DirtyRect &rect);
+  // Clips a rectangle to the bounds, false if nothing is left of it
+  boolean clip(int16_t x, int16_t y, int16_t width, int16_t height, DirtyRect &rect) const;
+  // Marks the whole area as damaged
+  void invalidate();
+  void clear();
+
+  boolean isEmpty() const;
+  boolean isFull() const;
+  uint8_t count() const;
+  const DirtyRect &get(uint8_t index) const;
+  uint32_t area() const;
+
+private:
+  static uint32_t areaOf(const DirtyRect &rect);
+  static DirtyRect unite(const DirtyRect &a, const DirtyRect &b);
+  static uint32_t mergeCost(const DirtyRect &a, const DirtyRect &b);
+  void mergeCheapestPair();
+
+  uint16_t width, height;
+  boolean full = false;
+  uint8_t rectCount = 0;
+  // one spare slot for the rectangle being added
+  DirtyRect rects[DIRTY_REGIONS_MAX + 1];
+};
+
+#endif
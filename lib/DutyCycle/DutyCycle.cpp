@@ -0,0 +1,148 @@
+#include "DutyCycle.h"
+#include <sys/time.h>
+#include <time.h>
+#ifdef ESP32
+#include <esp_sleep.h>
+
+// kept through deep sleep, lost on power cycles
+RTC_DATA_ATTR static DutyCycleState rtcState;
+#endif
+
+void DutyCycle::begin()
+{
+#ifdef ESP8266
+  coldStart = !ESP.rtcUserMemoryRead(DUTY_CYCLE_RTC_OFFSET, (uint32_t *)&state, sizeof(state));
+#endif
+#ifdef ESP32
+  state = rtcState;
+  coldStart = false;
+#endif
+  coldStart = coldStart || state.checksum != checksum(state);
+  if (coldStart)
+  {
+    memset(&state, 0, sizeof(state));
+    state.radio = true;
+    Serial.println("Duty cycle: cold start");
+    return;
+  }
+  state.wakes++;
+
+  // The ESP8266 clock starts over after deep sleep, the ESP32 one keeps
+  // running. The RTC timer drifts by a few percent, wakes that download wait
+  // for a time server in initTime() and correct it.
+  if (time(nullptr) < (time_t)state.sleepStart)
+  {
+    uint64_t micros = (uint64_t)state.sleepStartMicros + (uint64_t)state.sleepMillis * 1000 + (uint64_t)millis() * 1000;
+    struct timeval now = {(time_t)(state.sleepStart + micros / 1000000), (suseconds_t)(micros % 1000000)};
+    settimeofday(&now, nullptr);
+  }
+}
+
+boolean DutyCycle::isColdStart() const
+{
+  return coldStart;
+}
+
+boolean DutyCycle::isFetchDue(uint32_t interval) const
+{
+  return state.lastFetch == 0 || (uint32_t)time(nullptr) - state.lastFetch >= interval;
+}
+
+void DutyCycle::requireRadio()
+{
+#ifdef ESP8266
+  if (state.radio)
+  {
+    return;
+  }
+  Serial.println("Duty cycle: restarting with radio");
+  // a minimal sleep is the only way to get the radio back
+  deepSleep(0, true);
+#endif
+}
+
+void DutyCycle::fetchStarted()
+{
+  radioStart = millis();
+}
+
+void DutyCycle::fetchFinished(boolean success)
+{
+  radioMillis += millis() - radioStart;
+  if (success)
+  {
+    state.lastFetch = time(nullptr);
+  }
+}
+
+void DutyCycle::sleep(uint32_t fetchInterval)
+{
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  // wake right after the minute changed so the clock is correct all minute
+  uint32_t millisToMinute = (60 - now.tv_sec % 60) * 1000 - now.tv_usec / 1000;
+  uint32_t sleepMillis = max(millisToMinute, (uint32_t)1000);
+
+  unsigned long awake = millis();
+  // uA x ms to uAh, the radio draws on top of the active current
+  float awakeCharge = (awake * DUTY_CYCLE_ACTIVE_MA + radioMillis * (DUTY_CYCLE_RADIO_MA - DUTY_CYCLE_ACTIVE_MA)) * 1000.0f / 3600000;
+  float sleepCharge = sleepMillis * (float)DUTY_CYCLE_SLEEP_UA / 3600000;
+  float averageMicroAmps = (awakeCharge + sleepCharge) * 3600000 / (awake + sleepMillis);
+  state.totalMicroAmpHours += awakeCharge + sleepCharge;
+  Serial.printf("Duty cycle: wake %u awake %lu ms (radio %lu ms) %.1f uAh, asleep %u ms %.1f uAh, average %.0f uA, total %.0f uAh\n",
+                state.wakes, awake, radioMillis, awakeCharge, sleepMillis, sleepCharge, averageMicroAmps, state.totalMicroAmpHours);
+
+#ifdef ESP8266
+  // the radio only comes up calibrated when the next wake downloads
+  boolean radio = state.lastFetch == 0 || (uint32_t)now.tv_sec + sleepMillis / 1000 - state.lastFetch >= fetchInterval;
+#else
+  // the ESP32 always wakes with its radio available
+  boolean radio = true;
+#endif
+  deepSleep(sleepMillis, radio);
+}
+
+// FNV-1a over everything after the checksum
+uint32_t DutyCycle::checksum(const DutyCycleState &state)
+{
+  const uint8_t *fields = (const uint8_t *)&state + sizeof(state.checksum);
+  uint32_t value = 2166136261u;
+  for (size_t i = 0; i < sizeof(DutyCycleState) - sizeof(state.checksum); i++)
+  {
+    value = (value ^ fields[i]) * 16777619u;
+  }
+  // never 0, so zeroed memory does not pass
+  return value | 1;
+}
+
+void DutyCycle::save()
+{
+  state.checksum = checksum(state);
+#ifdef ESP8266
+  ESP.rtcUserMemoryWrite(DUTY_CYCLE_RTC_OFFSET, (uint32_t *)&state, sizeof(state));
+#endif
+#ifdef ESP32
+  rtcState = state;
+#endif
+}
+
+void DutyCycle::deepSleep(uint32_t millis, boolean radio)
+{
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  state.sleepStart = now.tv_sec;
+  state.sleepStartMicros = now.tv_usec;
+  state.sleepMillis = millis;
+  state.radio = radio;
+  save();
+  Serial.flush();
+#ifdef ESP8266
+  // needs GPIO16 wired to RST
+  // 0 would be forever
+  ESP.deepSleep(max((uint64_t)millis * 1000, (uint64_t)1), radio ? WAKE_RF_DEFAULT : WAKE_RF_DISABLED);
+#endif
+#ifdef ESP32
+  esp_sleep_enable_timer_wakeup((uint64_t)max(millis, (uint32_t)1) * 1000);
+  esp_deep_sleep_start();
+#endif
+}
@@ -0,0 +1,71 @@
+#ifndef _DUTY_CYCLE_H_
+#define _DUTY_CYCLE_H_
+
+#include <Arduino.h>
+
+// Offset in 4 byte blocks into the ESP8266 RTC user memory, right after
+// the WiFi cache
+#ifndef DUTY_CYCLE_RTC_OFFSET
+#define DUTY_CYCLE_RTC_OFFSET 40
+#endif
+
+// Supply currents used for the energy estimate, measure your board and
+// display to get realistic numbers
+#ifndef DUTY_CYCLE_ACTIVE_MA
+#define DUTY_CYCLE_ACTIVE_MA 80
+#endif
+#ifndef DUTY_CYCLE_RADIO_MA
+#define DUTY_CYCLE_RADIO_MA 170
+#endif
+#ifndef DUTY_CYCLE_SLEEP_UA
+#define DUTY_CYCLE_SLEEP_UA 20
+#endif
+
+// State carried from one wake to the next in RTC memory
+struct DutyCycleState
+{
+  // over all following fields, tells uninitialized RTC memory apart
+  uint32_t checksum;
+  uint32_t wakes;
+  // wall clock when going to sleep and how long the sleep was planned for
+  uint32_t sleepStart;
+  uint32_t sleepStartMicros;
+  uint32_t sleepMillis;
+  // wall clock of the last successful download, 0 if none yet
+  uint32_t lastFetch;
+  // charge used since the first wake
+  float totalMicroAmpHours;
+  // the radio was left calibrated for this wake, always set on ESP32
+  uint8_t radio;
+  uint8_t reserved[3];
+};
+
+// Battery mode: every wake renders, downloads only when the refresh interval
+// has passed and then sleeps until the next minute boundary. Keeps the clock
+// running across deep sleep and reports time and charge of each wake.
+class DutyCycle
+{
+public:
+  // Picks up the state of the previous wake and restores the clock from it
+  void begin();
+  boolean isColdStart() const;
+  boolean isFetchDue(uint32_t interval) const;
+  // Restarts with the radio on if the last sleep turned it off (ESP8266)
+  void requireRadio();
+  void fetchStarted();
+  void fetchFinished(boolean success);
+  // Reports this wake and sleeps, never returns
+  void sleep(uint32_t fetchInterval);
+
+private:
+  static uint32_t checksum(const DutyCycleState &state);
+  void save();
+  void deepSleep(uint32_t millis, boolean radio);
+
+  DutyCycleState state;
+  boolean coldStart = true;
+  unsigned long radioStart = 0;
+  unsigned long radioMillis = 0;
+};
+
+#endif
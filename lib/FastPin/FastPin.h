@@ -0,0 +1,92 @@
+#ifndef _FAST_PIN_H_
+#define _FAST_PIN_H_
+
+#include <Arduino.h>
+#ifdef ESP32
+#include <soc/gpio_struct.h>
+#endif
+
+// Output pin written with a single store to the GPIO set and clear registers
+// on ESP8266 and ESP32, instead of a digitalWrite() call each time. GPIO16 of
+// the ESP8266 lives outside those registers and other boards have no such
+// registers, those go through digitalWrite(). A negative pin is not
+// connected and ignored.
+class FastPin
+{
+public:
+  void begin(int8_t pin)
+  {
+    this->pin = pin;
+    mask = 0;
+    if (pin < 0)
+    {
+      return;
+    }
+    pinMode(pin, OUTPUT);
+#if defined(ESP8266)
+    if (pin < 16)
+    {
+      mask = 1UL << pin;
+    }
+#elif defined(ESP32)
+    mask = 1UL << (pin & 31);
+#endif
+  }
+
+  inline void high() __attribute__((always_inline))
+  {
+#if defined(ESP8266)
+    if (mask != 0)
+    {
+      GPOS = mask;
+      return;
+    }
+#elif defined(ESP32)
+    if (pin >= 32)
+    {
+      GPIO.out1_w1ts.val = mask;
+    }
+    else
+    {
+      GPIO.out_w1ts = mask;
+    }
+    return;
+#endif
+    if (pin >= 0)
+    {
+      digitalWrite(pin, HIGH);
+    }
+  }
+
+  inline void low() __attribute__((always_inline))
+  {
+#if defined(ESP8266)
+    if (mask != 0)
+    {
+      GPOC = mask;
+      return;
+    }
+#elif defined(ESP32)
+    if (pin >= 32)
+    {
+      GPIO.out1_w1tc.val = mask;
+    }
+    else
+    {
+      GPIO.out_w1tc = mask;
+    }
+    return;
+#endif
+    if (pin >= 0)
+    {
+      digitalWrite(pin, LOW);
+    }
+  }
+
+private:
+  int8_t pin = -1;
+  // 0 for pins written through digitalWrite(), and for no pin on ESP32
+  uint32_t mask = 0;
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef _HARDWARE_SCROLL_H_
+#define _HARDWARE_SCROLL_H_
+
+#include <Arduino.h>
+
+// Vertical scrolling done by the display controller. Inside the scroll area
+// the panel shows its memory rotated by an offset, so content can move
+// without being sent again.
+class HardwareScroll
+{
+public:
+  virtual ~HardwareScroll() {}
+
+  // Rows [top, top + height) in display coordinates scroll, all others stay.
+  // False if the panel cannot scroll that area in its current rotation.
+  virtual boolean setScrollArea(uint16_t top, uint16_t height) = 0;
+  // Row i of the area shows the row written at top + (i + offset) % height.
+  // Takes effect with the next flush, so it lands together with the rows
+  // that were sent for it.
+  virtual void setScrollOffset(uint16_t offset) = 0;
+};
+
+#endif
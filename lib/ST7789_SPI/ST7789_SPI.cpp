@@ -38,6 +38,9 @@ Many thanks go to various contributors such as Adafruit, Waveshare.
 
 #include <limits.h>
 #include <SPI.h>
+#ifdef ST7789_USE_DMA
+#include <esp_heap_caps.h>
+#endif
 
 #define FILLARRAY(a, n) a[0] = n, memcpy(((char *)a) + sizeof(a[0]), a, sizeof(a) - sizeof(a[0]));
 
@@ -138,45 +141,31 @@ void ST7789_SPI::spiwrite(uint8_t c)
     SPCR = backupSPCR;
 #endif
 #else
+#ifdef ST7789_USE_DMA
+    if (dmaDevice != nullptr)
+    {
+      writeBytes(&c, 1);
+      return;
+    }
+#endif
     SPI.transfer(c);
 #endif
   }
   else
   {
-#if defined(ESP8266) || defined(ESP32) || defined(ARDUINO_ARCH_ARC32)
-    for (uint8_t bit = 0x80; bit; bit >>= 1)
-    {
-      if (c & bit)
-      {
-        digitalWrite(_mosi, HIGH);
-      }
-      else
-      {
-        digitalWrite(_mosi, LOW);
-      }
-      digitalWrite(_sclk, HIGH);
-      digitalWrite(_sclk, LOW);
-    }
-#else
-    // Fast SPI bitbang swiped from LPD8806 library
     for (uint8_t bit = 0x80; bit; bit >>= 1)
     {
       if (c & bit)
       {
-        //digitalWrite(_mosi, HIGH);
-        *mosiport |= mosipinmask;
+        mosiPin.high();
       }
       else
       {
-        //digitalWrite(_mosi, LOW);
-        *mosiport &= ~mosipinmask;
+        mosiPin.low();
       }
-      //digitalWrite(_sclk, HIGH);
-      *clkport |= clkpinmask;
-      //digitalWrite(_sclk, LOW);
-      *clkport &= ~clkpinmask;
+      sclkPin.high();
+      sclkPin.low();
     }
-#endif
   }
 }
 
@@ -187,41 +176,23 @@ void ST7789_SPI::setFastRefresh(boolean isFastRefreshEnabled)
 
 void ST7789_SPI::writecommand(uint8_t c)
 {
-#if defined(USE_FAST_PINIO)
-  *dcport &= ~dcpinmask;
-  *csport &= ~cspinmask;
-#else
-  digitalWrite(_dc, LOW);
-  digitalWrite(_sclk, LOW);
-  digitalWrite(_cs, LOW);
-#endif
+  dcPin.low();
+  sclkPin.low();
+  csPin.low();
 
   spiwrite(c);
 
-#if defined(USE_FAST_PINIO)
-  *csport |= cspinmask;
-#else
-  digitalWrite(_cs, HIGH);
-#endif
+  csPin.high();
 }
 
 void ST7789_SPI::writedata(uint8_t c)
 {
-#if defined(USE_FAST_PINIO)
-  *dcport |= dcpinmask;
-  *csport &= ~cspinmask;
-#else
-  digitalWrite(_dc, HIGH);
-  digitalWrite(_cs, LOW);
-#endif
+  dcPin.high();
+  csPin.low();
 
   spiwrite(c);
 
-#if defined(USE_FAST_PINIO)
-  *csport |= cspinmask;
-#else
-  digitalWrite(_cs, HIGH);
-#endif
+  csPin.high();
 }
 
 // Rather than a bazillion writecommand() and writedata() calls, screen
@@ -234,11 +205,34 @@ void ST7789_SPI::writedata(uint8_t c)
 void ST7789_SPI::sendCommand(uint8_t commandByte, const uint8_t *dataBytes,
                              uint8_t numDataBytes)
 {
-  writecommand(commandByte);
-
+  csPin.low();
+  dcPin.low();
+  spiwrite(commandByte);
+  dcPin.high();
   for (int i = 0; i < numDataBytes; i++)
   {
-    writedata(pgm_read_byte(dataBytes++));
+    spiwrite(pgm_read_byte(dataBytes++));
+  }
+  csPin.high();
+}
+
+// DC is the only pin toggled between the command and its parameters, which
+// go out in one write on hardware SPI
+void ST7789_SPI::sendCommandBytes(uint8_t command, const uint8_t *data, uint8_t length)
+{
+  dcPin.low();
+  spiwrite(command);
+  dcPin.high();
+  if (hwSPI && length > 0)
+  {
+    writeBytes(data, length);
+  }
+  else
+  {
+    for (uint8_t i = 0; i < length; i++)
+    {
+      spiwrite(data[i]);
+    }
   }
 }
 
@@ -276,19 +270,17 @@ void ST7789_SPI::init(void)
     digitalWrite(_rst, LOW);
   }
 
-  pinMode(_dc, OUTPUT);
-  pinMode(_cs, OUTPUT);
-
-#if defined(USE_FAST_PINIO)
-  csport = portOutputRegister(digitalPinToPort(_cs));
-  cspinmask = digitalPinToBitMask(_cs);
-  dcport = portOutputRegister(digitalPinToPort(_dc));
-  dcpinmask = digitalPinToBitMask(_dc);
-#endif
+  dcPin.begin(_dc);
+  csPin.begin(_cs);
 
   if (hwSPI)
   { // Using hardware SPI
-    SPI.begin();
+#ifdef ST7789_USE_DMA
+    // the DMA device takes the bus over, only without it SPI drives the bus
+    initDma();
+    if (dmaDevice == nullptr)
+#endif
+      SPI.begin();
 
 #ifndef SPI_HAS_TRANSACTION
     SPI.setBitOrder(MSBFIRST);
@@ -305,18 +297,11 @@ void ST7789_SPI::init(void)
   }
   else
   {
-    pinMode(_sclk, OUTPUT);
-    pinMode(_mosi, OUTPUT);
+    sclkPin.begin(_sclk);
+    mosiPin.begin(_mosi);
     pinMode(_miso, INPUT);
-
-#if defined(USE_FAST_PINIO)
-    clkport = portOutputRegister(digitalPinToPort(_sclk));
-    clkpinmask = digitalPinToBitMask(_sclk);
-    mosiport = portOutputRegister(digitalPinToPort(_mosi));
-    mosipinmask = digitalPinToBitMask(_mosi);
-    *clkport &= ~clkpinmask;
-    *mosiport &= ~mosipinmask;
-#endif
+    sclkPin.low();
+    mosiPin.low();
   }
 
   // toggle RST low to reset
@@ -330,31 +315,71 @@ void ST7789_SPI::init(void)
     delay(150);
   }
 
-  if (hwSPI)
-    spi_begin();
+  beginWrite();
 
   displayInit(generic_st7789);
 
+  endWrite();
+}
+
+// SPI transactions around hardware SPI writes, the DMA device needs none as it
+// has the bus to itself
+void ST7789_SPI::beginWrite()
+{
+#ifdef ST7789_USE_DMA
+  if (dmaDevice != nullptr)
+  {
+    return;
+  }
+#endif
   if (hwSPI)
+  {
+    spi_begin();
+  }
+}
+
+void ST7789_SPI::endWrite()
+{
+#ifdef ST7789_USE_DMA
+  if (dmaDevice != nullptr)
+  {
+    return;
+  }
+#endif
+  if (hwSPI)
+  {
     spi_end();
+  }
+}
+
+// Hardware SPI writes, through the DMA device once it has the bus
+void ST7789_SPI::writeBytes(const uint8_t *data, uint32_t length)
+{
+#ifdef ST7789_USE_DMA
+  if (dmaDevice != nullptr)
+  {
+    writeBytesDma(data, length);
+    return;
+  }
+#endif
+  SPI.writeBytes((uint8_t *)data, length);
 }
 
 void ST7789_SPI::setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1,
                                uint16_t y1)
 {
-  writecommand(ST77XX_CASET); // Column addr set
-  writedata(x0 >> 8);
-  writedata(x0 & 0xFF); // XSTART
-  writedata(x1 >> 8);
-  writedata(x1 & 0xFF); // XEND
-
-  writecommand(ST77XX_RASET); // Row addr set
-  writedata(y0 >> 8);
-  writedata(y0); // YSTART
-  writedata(y1 >> 8);
-  writedata(y1); // YEND
+  csPin.low();
+  sendAddrWindow(x0, y0, x1, y1);
+  csPin.high();
+}
 
-  writecommand(ST77XX_RAMWR); // write to RAM
+void ST7789_SPI::sendAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  uint8_t columns[] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1};
+  uint8_t rows[] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1};
+  sendCommandBytes(ST77XX_CASET, columns, sizeof(columns));
+  sendCommandBytes(ST77XX_RASET, rows, sizeof(rows));
+  sendCommandBytes(ST77XX_RAMWR, nullptr, 0);
 }
 
 #define MADCTL_MY 0x80
@@ -368,8 +393,7 @@ void ST7789_SPI::setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1,
 void ST7789_SPI::setRotation(uint8_t m)
 {
 
-  if (hwSPI)
-    spi_begin();
+  beginWrite();
 
   // writecommand(ST7789_MADCTL);
   // rotation = m % 4; // can't be higher than 3
@@ -396,6 +420,16 @@ void ST7789_SPI::setRotation(uint8_t m)
   //    break;
   // }
 
+  if (scrollHeight > 0)
+  {
+    // the whole panel as scroll area without offset is the reset state
+    scrollTop = 0;
+    scrollHeight = ST7789_TFTHEIGHT;
+    writeScrollArea(0, ST7789_TFTHEIGHT);
+    writeScrollStart(0);
+    scrollHeight = 0;
+  }
+
   uint8_t madctl = 0;
 
   rotation = m & 3; // can't be higher than 3
@@ -426,91 +460,395 @@ void ST7789_SPI::setRotation(uint8_t m)
 
   sendCommand(ST77XX_MADCTL, &madctl, 1);
 
-  if (hwSPI)
-    spi_end();
+  endWrite();
 }
 
 void ST7789_SPI::pushColor(uint16_t color)
 {
-  if (hwSPI)
-    spi_begin();
+  beginWrite();
 
-  digitalWrite(_dc, HIGH);
-  digitalWrite(_cs, LOW);
+  dcPin.high();
+  csPin.low();
 
   spiwrite(color >> 8);
   spiwrite(color);
 
-  digitalWrite(_cs, HIGH);
+  csPin.high();
 
-  if (hwSPI)
-    spi_end();
+  endWrite();
+}
+
+void ST7789_SPI::setPaletteLutEnabled(boolean isPaletteLutEnabled)
+{
+  paletteLutEnabled = isPaletteLutEnabled;
+}
+
+// (Re)builds the lookup table if bit depth or palette changed since the last
+// flush. Returns false if the bit depth is not supported or memory is short,
+// the caller then falls back to unpacking pixel by pixel.
+boolean ST7789_SPI::updatePaletteLut(const uint16_t *palette, uint8_t bitsPerPixel)
+{
+  if (bitsPerPixel != 1 && bitsPerPixel != 2 && bitsPerPixel != 4)
+    return false;
+
+  uint8_t colors = 1 << bitsPerPixel;
+  if (paletteLut != nullptr && paletteLutBitsPerPixel == bitsPerPixel &&
+      memcmp(paletteLutColors, palette, colors * sizeof(uint16_t)) == 0)
+    return true;
+
+  uint8_t pixelsPerByte = 8 / bitsPerPixel;
+  if (paletteLutBitsPerPixel != bitsPerPixel)
+  {
+    free(paletteLut);
+    paletteLut = (uint16_t *)malloc(256 * pixelsPerByte * sizeof(uint16_t));
+    paletteLutBitsPerPixel = paletteLut != nullptr ? bitsPerPixel : 0;
+    if (paletteLut == nullptr)
+      return false;
+  }
+  memcpy(paletteLutColors, palette, colors * sizeof(uint16_t));
+
+  uint8_t mask = colors - 1;
+  uint16_t *entry = paletteLut;
+  for (uint16_t value = 0; value < 256; value++)
+  {
+    for (uint8_t p = 0; p < pixelsPerByte; p++)
+    {
+      uint16_t color = palette[(value >> (p * bitsPerPixel)) & mask];
+      // swap to MSB first, so a line can go to SPI as it is
+      *entry++ = (color << 8) | (color >> 8);
+    }
+  }
+  return true;
+}
+
+// Expands one line of packed palette indexes, one table entry per source byte
+template <uint8_t pixelsPerByte>
+static inline void expandLineWith(uint16_t *target, const uint8_t *source, uint16_t bytes, const uint16_t *lut)
+{
+  while (bytes--)
+  {
+    memcpy(target, lut + *source++ * pixelsPerByte, pixelsPerByte * sizeof(uint16_t));
+    target += pixelsPerByte;
+  }
+}
+
+void ST7789_SPI::expandLine(uint16_t *target, const uint8_t *source, uint16_t bytes, uint8_t pixelsPerByte)
+{
+  switch (pixelsPerByte)
+  {
+  case 2:
+    expandLineWith<2>(target, source, bytes, paletteLut);
+    break;
+  case 4:
+    expandLineWith<4>(target, source, bytes, paletteLut);
+    break;
+  case 8:
+    expandLineWith<8>(target, source, bytes, paletteLut);
+    break;
+  }
+}
+
+#ifdef ST7789_USE_DMA
+// Takes VSPI over with a DMA capable device, which then carries every write
+// to the display. SPI must not drive the bus as well, the two drivers would
+// interleave on the one controller. On failure the bus is left to SPI.
+void ST7789_SPI::initDma()
+{
+  uint16_t lineBytes = max(ST7789_TFTWIDTH, ST7789_TFTHEIGHT) * 2;
+
+  spi_bus_config_t bus = {};
+  bus.mosi_io_num = MOSI;
+  bus.miso_io_num = -1;
+  bus.sclk_io_num = SCK;
+  bus.quadwp_io_num = -1;
+  bus.quadhd_io_num = -1;
+  bus.max_transfer_sz = lineBytes;
+
+  spi_device_interface_config_t device = {};
+  device.mode = SPI_MODE;
+  device.clock_speed_hz = 40000000; // same as spi_begin()
+  device.spics_io_num = -1;         // CS is toggled by hand
+  device.queue_size = ST7789_DMA_BUFFERS;
+  device.flags = SPI_DEVICE_NO_DUMMY;
+
+  if (spi_bus_initialize(VSPI_HOST, &bus, 1) != ESP_OK)
+  {
+    dmaDevice = nullptr;
+    return;
+  }
+  if (spi_bus_add_device(VSPI_HOST, &device, &dmaDevice) != ESP_OK)
+  {
+    dmaDevice = nullptr;
+    spi_bus_free(VSPI_HOST);
+    return;
+  }
+
+  for (uint8_t i = 0; i < ST7789_DMA_BUFFERS; i++)
+  {
+    dmaLines[i] = (uint16_t *)heap_caps_malloc(lineBytes, MALLOC_CAP_DMA);
+    if (dmaLines[i] == nullptr)
+    {
+      // not enough DMA capable memory, stay on the synchronous path
+      while (i--)
+        heap_caps_free(dmaLines[i]);
+      spi_bus_remove_device(dmaDevice);
+      spi_bus_free(VSPI_HOST);
+      dmaDevice = nullptr;
+      return;
+    }
+  }
+}
+
+// Commands, their parameters and 16 bit pixels as polling transactions. Up to
+// four bytes travel inside the transaction, longer writes are copied through
+// the first line buffer, which is DMA capable and word aligned as DMA needs.
+void ST7789_SPI::writeBytesDma(const uint8_t *data, uint32_t length)
+{
+  spi_transaction_t transaction = {};
+  if (length <= sizeof(transaction.tx_data))
+  {
+    transaction.flags = SPI_TRANS_USE_TXDATA;
+    transaction.length = length * 8; // in bits
+    memcpy(transaction.tx_data, data, length);
+    spi_device_polling_transmit(dmaDevice, &transaction);
+    return;
+  }
+  uint32_t lineBytes = max(ST7789_TFTWIDTH, ST7789_TFTHEIGHT) * 2;
+  while (length > 0)
+  {
+    uint32_t chunk = min(length, lineBytes);
+    memcpy(dmaLines[0], data, chunk);
+    transaction.length = chunk * 8;
+    transaction.tx_buffer = dmaLines[0];
+    spi_device_polling_transmit(dmaDevice, &transaction);
+    data += chunk;
+    length -= chunk;
+  }
+}
+
+// Queues one transaction per line. Once all buffers are in flight the oldest
+// one is waited for and refilled, so expanding line k+1 overlaps sending line k.
+void ST7789_SPI::writeLinesDma(const uint8_t *buffer, uint16_t stride, uint16_t bytesPerLine, uint16_t lines, uint8_t pixelsPerByte)
+{
+  uint8_t queued = 0;
+  spi_transaction_t *finished;
+
+  spi_device_acquire_bus(dmaDevice, portMAX_DELAY);
+  for (uint16_t y = 0; y < lines; y++)
+  {
+    uint8_t slot = y % ST7789_DMA_BUFFERS;
+    if (queued == ST7789_DMA_BUFFERS)
+    {
+      // results come back in queue order, this frees exactly this slot
+      spi_device_get_trans_result(dmaDevice, &finished, portMAX_DELAY);
+      queued--;
+    }
+    expandLine(dmaLines[slot], buffer, bytesPerLine, pixelsPerByte);
+    buffer += stride;
+
+    spi_transaction_t *transaction = &dmaTransactions[slot];
+    memset(transaction, 0, sizeof(spi_transaction_t));
+    transaction->length = bytesPerLine * pixelsPerByte * 16; // in bits
+    transaction->tx_buffer = dmaLines[slot];
+    spi_device_queue_trans(dmaDevice, transaction, portMAX_DELAY);
+    queued++;
+  }
+  while (queued--)
+  {
+    spi_device_get_trans_result(dmaDevice, &finished, portMAX_DELAY);
+  }
+  spi_device_release_bus(dmaDevice);
+}
+#endif
+
+boolean ST7789_SPI::setScrollArea(uint16_t top, uint16_t height)
+{
+  if ((rotation != 0 && rotation != 2) || ST7789_TFTHEIGHT != 320 || height == 0 || top + height > _height)
+  {
+    return false;
+  }
+  scrollTop = top;
+  scrollHeight = height;
+  pendingScrollOffset = 0;
+
+  beginWrite();
+  writeScrollArea(top, height);
+  writeScrollStart(0);
+  endWrite();
+  return true;
+}
+
+void ST7789_SPI::setScrollOffset(uint16_t offset)
+{
+  pendingScrollOffset = scrollHeight > 0 ? offset % scrollHeight : 0;
+}
+
+// The controller counts scroll lines in memory order. Rotation 0 sets MY and
+// writes rows bottom up, so there the area is mirrored and scrolls backwards.
+void ST7789_SPI::writeScrollArea(uint16_t top, uint16_t height)
+{
+  uint16_t fixed = rotation == 0 ? ST7789_TFTHEIGHT - top - height : top;
+  // top fixed area, scroll area and bottom fixed area
+  uint16_t lines[] = {fixed, height, (uint16_t)(ST7789_TFTHEIGHT - fixed - height)};
+  uint8_t data[6];
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    data[i * 2] = lines[i] >> 8;
+    data[i * 2 + 1] = lines[i] & 0xFF;
+  }
+  csPin.low();
+  sendCommandBytes(ST77XX_VSCRDEF, data, sizeof(data));
+  csPin.high();
+}
+
+void ST7789_SPI::writeScrollStart(uint16_t offset)
+{
+  uint16_t line = rotation == 0 ? ST7789_TFTHEIGHT - scrollTop - scrollHeight + (scrollHeight - offset) % scrollHeight
+                                : scrollTop + offset;
+  uint8_t data[] = {(uint8_t)(line >> 8), (uint8_t)line};
+  csPin.low();
+  sendCommandBytes(ST77XX_VSCRSADD, data, sizeof(data));
+  csPin.high();
+  scrollOffset = offset;
+}
+
+void ST7789_SPI::setDirtyRegions(DirtyRegions *dirtyRegions)
+{
+  this->dirtyRegions = dirtyRegions;
 }
 
 void ST7789_SPI::writeBuffer(BufferInfo *bufferInfo)
 {
-  if (hwSPI)
-    spi_begin();
+  beginWrite();
+
+  // rows of the buffer that are on the display, a band may reach past the end
+  uint16_t top = bufferInfo->targetY;
+  uint16_t rows = top < _height ? min(bufferInfo->bufferHeight, (uint16_t)(_height - top)) : 0;
+
+  // buffers as wide as the display with known damage only send the damaged
+  // parts, clipped to the rows the buffer holds
+  if (dirtyRegions != nullptr && !dirtyRegions->isEmpty() && !dirtyRegions->isFull() &&
+      bufferInfo->targetX == 0 && bufferInfo->bufferWidth == _width)
+  {
+    for (uint8_t i = 0; i < dirtyRegions->count(); i++)
+    {
+      const DirtyRect &rect = dirtyRegions->get(i);
+      uint16_t y0 = max(rect.y0, top);
+      uint16_t y1 = min(rect.y1, (uint16_t)(top + rows));
+      if (y0 < y1)
+      {
+        writeWindow(bufferInfo, rect.x0, y0 - top, rect.x1, y1 - top);
+      }
+    }
+  }
+  else if (rows > 0)
+  {
+    // every row goes back where it belongs, which only shows right unscrolled
+    pendingScrollOffset = 0;
+    if (scrollOffset != 0)
+    {
+      writeScrollStart(0);
+    }
+    writeWindow(bufferInfo, 0, 0, bufferInfo->bufferWidth, rows);
+  }
+  // the rows the new offset exposes were just sent
+  if (pendingScrollOffset != scrollOffset)
+  {
+    writeScrollStart(pendingScrollOffset);
+  }
+
+  endWrite();
+}
+
+// Sends the part [x0, x1) x [y0, y1) of the buffer to its place on the display
+void ST7789_SPI::writeWindow(BufferInfo *bufferInfo, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
   uint8_t *buffer = bufferInfo->buffer;
   uint16_t bufferWidth = bufferInfo->bufferWidth;
-  uint16_t bufferHeight = bufferInfo->bufferHeight;
   uint16_t xPos = bufferInfo->targetX;
   uint16_t yPos = bufferInfo->targetY;
   uint16_t *palette = bufferInfo->palette;
   uint8_t bitsPerPixel = bufferInfo->bitsPerPixel;
+  uint8_t packagesPerBytes = bitsPerPixel < 8 ? 8 / bitsPerPixel : 1;
 
-  setAddrWindow(xPos, yPos, xPos + bufferWidth - 1, yPos + bufferHeight - 1);
+  // paletted windows start and end on whole source bytes
+  x0 -= x0 % packagesPerBytes;
+  x1 += (packagesPerBytes - x1 % packagesPerBytes) % packagesPerBytes;
+  uint16_t windowWidth = x1 - x0;
+  uint16_t windowHeight = y1 - y0;
 
-  digitalWrite(_dc, HIGH);
-  digitalWrite(_cs, LOW);
+  // the address window and the pixels share one CS assertion
+  csPin.low();
+  sendAddrWindow(xPos + x0, yPos + y0, xPos + x1 - 1, yPos + y1 - 1);
   if (bitsPerPixel == 16)
   {
-    SPI.writeBytes(buffer, bufferWidth * bufferHeight * 2);
-    /*for (uint16_t y = 0; y < bufferHeight; y++) {
-        for (uint16_t x = 0; x < bufferWidth; x++) {
-
-        }
-      }*/
+    if (windowWidth == bufferWidth)
+    {
+      writeBytes(buffer + y0 * bufferWidth * 2, windowWidth * windowHeight * 2);
+    }
+    else
+    {
+      for (uint16_t y = y0; y < y1; y++)
+      {
+        writeBytes(buffer + (y * bufferWidth + x0) * 2, windowWidth * 2);
+      }
+    }
   }
   else
   {
-    // line buffer is in 16bit target format
-    uint8_t lineBuffer[_width * 2];
-    uint16_t pos;
-    uint8_t bufferByte;
-    uint8_t paletteEntry;
-    uint16_t color;
-    uint8_t shift;
-    uint8_t mask = (1 << bitsPerPixel) - 1;
-    uint8_t packagesPerBytes = 8 / bitsPerPixel;
-    uint16_t bytePos = 0;
-    uint16_t pixelCounter = 0;
-    uint16_t bufferSize = bufferWidth * bufferHeight / packagesPerBytes;
-    uint8_t bytesPerLine = bufferWidth / packagesPerBytes;
-    uint16_t x = 0;
-    for (uint16_t y = 0; y < bufferHeight; y++)
-    {
+    uint16_t bytesPerLine = bufferWidth / packagesPerBytes;
+    uint16_t bytesPerWindowLine = windowWidth / packagesPerBytes;
+    buffer += y0 * bytesPerLine + x0 / packagesPerBytes;
 
-      for (uint16_t b = 0; b < bytesPerLine; b++)
+    if (paletteLutEnabled && updatePaletteLut(palette, bitsPerPixel))
+    {
+#ifdef ST7789_USE_DMA
+      if (dmaDevice != nullptr)
       {
-
-        for (uint8_t p = 0; p < packagesPerBytes; p++)
+        writeLinesDma(buffer, bytesPerLine, bytesPerWindowLine, windowHeight, packagesPerBytes);
+      }
+      else
+#endif
+      {
+        // line buffer is in 16bit target format
+        uint16_t lineBuffer[_width];
+        for (uint16_t y = 0; y < windowHeight; y++)
+        {
+          expandLine(lineBuffer, buffer, bytesPerWindowLine, packagesPerBytes);
+          buffer += bytesPerLine;
+          writeBytes((uint8_t *)lineBuffer, windowWidth * 2);
+        }
+      }
+    }
+    else
+    {
+      // line buffer is in 16bit target format
+      uint8_t lineBuffer[_width * 2];
+      uint8_t bufferByte;
+      uint8_t paletteEntry;
+      uint16_t color;
+      uint8_t shift;
+      uint8_t mask = (1 << bitsPerPixel) - 1;
+      uint16_t x = 0;
+      for (uint16_t y = 0; y < windowHeight; y++)
+      {
+        for (uint16_t b = 0; b < bytesPerWindowLine; b++)
         {
-          x = b * packagesPerBytes + p;
-          bufferByte = buffer[bytePos];
-          shift = p * bitsPerPixel;
-          paletteEntry = (bufferByte >> shift) & mask;
-          color = palette[paletteEntry];
-          lineBuffer[x * 2] = color >> 8;
-          lineBuffer[x * 2 + 1] = color;
+          bufferByte = buffer[b];
+          for (uint8_t p = 0; p < packagesPerBytes; p++)
+          {
+            x = b * packagesPerBytes + p;
+            shift = p * bitsPerPixel;
+            paletteEntry = (bufferByte >> shift) & mask;
+            color = palette[paletteEntry];
+            lineBuffer[x * 2] = color >> 8;
+            lineBuffer[x * 2 + 1] = color;
+          }
         }
-        bytePos++;
+        buffer += bytesPerLine;
+        writeBytes(lineBuffer, windowWidth * 2);
       }
-      SPI.writeBytes(lineBuffer, bufferWidth * 2);
     }
   }
-  digitalWrite(_cs, HIGH);
-
-  if (hwSPI)
-    spi_end();
+  csPin.high();
 }
@@ -35,12 +35,28 @@ Many thanks go to various contributors such as Adafruit, Waveshare.
 #include "WProgram.h"
 #endif
 #include "DisplayDriver.h"
+#include "DirtyRegions.h"
+#include "HardwareScroll.h"
+#include "FastPin.h"
 #if defined(__AVR__)
 #include <avr/pgmspace.h>
 #elif defined(ESP8266)
 #include <pgmspace.h>
 #endif
 
+// On ESP32 paletted flushes stream lines through DMA while the next line is
+// expanded. The display then has VSPI to itself, nothing else may use SPI on
+// it. Define ST7789_NO_DMA to force the synchronous path through SPI.
+#if defined(ESP32) && !defined(ST7789_NO_DMA)
+#define ST7789_USE_DMA
+#include <driver/spi_master.h>
+#endif
+
+// Number of DMA line buffers in flight
+#ifndef ST7789_DMA_BUFFERS
+#define ST7789_DMA_BUFFERS 2
+#endif
+
 #define ST_CMD_DELAY 0x80 // special signifier for command lists
 
 #define ST77XX_NOP 0x00
@@ -63,9 +79,11 @@ Many thanks go to various contributors such as Adafruit, Waveshare.
 #define ST77XX_RAMRD 0x2E
 
 #define ST77XX_PTLAR 0x30
+#define ST77XX_VSCRDEF 0x33
 #define ST77XX_TEOFF 0x34
 #define ST77XX_TEON 0x35
 #define ST77XX_MADCTL 0x36
+#define ST77XX_VSCRSADD 0x37
 #define ST77XX_COLMOD 0x3A
 
 #define ST77XX_MADCTL_MY 0x80
@@ -132,7 +150,7 @@ Many thanks go to various contributors such as Adafruit, Waveshare.
 #define ST7789_TFTHEIGHT 320
 #endif
 
-class ST7789_SPI : public DisplayDriver
+class ST7789_SPI : public DisplayDriver, public HardwareScroll
 {
 
 public:
@@ -145,9 +163,19 @@ public:
   void setRotation(uint8_t r);
 
   void writeBuffer(BufferInfo *bufferInfo);
+  // Buffers as wide as the display, whole frames or bands at their targetY,
+  // are only flushed where these regions (in display coordinates) are damaged
+  void setDirtyRegions(DirtyRegions *dirtyRegions);
 
   void pushColor(uint16_t color);
   void setFastRefresh(boolean isFastRefreshEnabled);
+  // Expand paletted buffers through a byte-to-pixels lookup table (default on)
+  void setPaletteLutEnabled(boolean isPaletteLutEnabled);
+
+  // Only in the portrait rotations 0 and 2 of a 320 line panel, the others
+  // would scroll sideways. Changing the rotation ends scrolling.
+  boolean setScrollArea(uint16_t top, uint16_t height);
+  void setScrollOffset(uint16_t offset);
 
   void spiwrite(uint8_t);
   void writecommand(uint8_t c);
@@ -156,9 +184,44 @@ public:
 private:
   void displayInit(const uint8_t *addr);
   void sendCommand(uint8_t commandByte, const uint8_t *dataBytes, uint8_t numDataBytes);
+  // A command and its parameters from RAM, CS has to be low already
+  void sendCommandBytes(uint8_t command, const uint8_t *data, uint8_t length);
+  void beginWrite();
+  void endWrite();
+  void writeBytes(const uint8_t *data, uint32_t length);
+  void sendAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+  void writeWindow(BufferInfo *bufferInfo, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+  boolean updatePaletteLut(const uint16_t *palette, uint8_t bitsPerPixel);
+  void writeScrollArea(uint16_t top, uint16_t height);
+  void writeScrollStart(uint16_t offset);
+  void expandLine(uint16_t *target, const uint8_t *source, uint16_t bytes, uint8_t pixelsPerByte);
+#ifdef ST7789_USE_DMA
+  void initDma();
+  void writeBytesDma(const uint8_t *data, uint32_t length);
+  void writeLinesDma(const uint8_t *buffer, uint16_t stride, uint16_t bytesPerLine, uint16_t lines, uint8_t pixelsPerByte);
+#endif
 
   boolean hwSPI;
   int32_t _cs, _dc, _rst, _mosi, _miso, _sclk;
+  FastPin csPin, dcPin, mosiPin, sclkPin;
+  DirtyRegions *dirtyRegions = nullptr;
+
+  // Scroll area in display rows, 0 rows if not scrolling
+  uint16_t scrollTop = 0, scrollHeight = 0;
+  uint16_t scrollOffset = 0, pendingScrollOffset = 0;
+
+  // For every possible source byte the lookup table holds the 8 / bitsPerPixel
+  // pixels it packs, already converted to big-endian RGB565 as sent on the wire.
+  boolean paletteLutEnabled = true;
+  uint16_t *paletteLut = nullptr;
+  uint16_t paletteLutColors[16];
+  uint8_t paletteLutBitsPerPixel = 0;
+
+#ifdef ST7789_USE_DMA
+  spi_device_handle_t dmaDevice = nullptr;
+  uint16_t *dmaLines[ST7789_DMA_BUFFERS];
+  spi_transaction_t dmaTransactions[ST7789_DMA_BUFFERS];
+#endif
 };
 
 #endif
@@ -0,0 +1,52 @@
+#ifndef _SNAPSHOT_EXCHANGE_H_
+#define _SNAPSHOT_EXCHANGE_H_
+
+#include <Arduino.h>
+#include <atomic>
+
+// Lock-free handoff of the latest value from one producer task to one
+// consumer task (a triple buffer). Each side owns a slot, the third one is
+// swapped between them, so neither ever waits or sees a half written value.
+template <typename T>
+class SnapshotExchange
+{
+public:
+  // Slot the producer fills before calling publish()
+  T *writeSlot()
+  {
+    return &slots[writeIndex];
+  }
+
+  void publish()
+  {
+    writeIndex = shared.exchange(writeIndex | FRESH, std::memory_order_acq_rel) & INDEX;
+  }
+
+  // Takes over the last published value, false if nothing new was published
+  boolean acquire()
+  {
+    if (!(shared.load(std::memory_order_acquire) & FRESH))
+    {
+      return false;
+    }
+    readIndex = shared.exchange(readIndex, std::memory_order_acq_rel) & INDEX;
+    return true;
+  }
+
+  // Slot the consumer reads, stays untouched until the next acquire()
+  const T *readSlot() const
+  {
+    return &slots[readIndex];
+  }
+
+private:
+  static const uint8_t INDEX = 0x03;
+  static const uint8_t FRESH = 0x04;
+
+  T slots[3];
+  uint8_t writeIndex = 0;
+  uint8_t readIndex = 1;
+  std::atomic<uint8_t> shared{2};
+};
+
+#endif
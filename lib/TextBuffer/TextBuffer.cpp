@@ -0,0 +1,63 @@
+#include "TextBuffer.h"
+#include <stdarg.h>
+
+TextBuffer::TextBuffer(char *buffer, size_t capacity)
+{
+  this->buffer = buffer;
+  this->capacity = capacity;
+  clear();
+}
+
+void TextBuffer::clear()
+{
+  used = 0;
+  buffer[0] = '\0';
+}
+
+TextBuffer &TextBuffer::print(const char *text)
+{
+  while (*text != '\0' && used + 1 < capacity)
+  {
+    buffer[used++] = *text++;
+  }
+  buffer[used] = '\0';
+  return *this;
+}
+
+TextBuffer &TextBuffer::print(char c)
+{
+  if (used + 1 < capacity)
+  {
+    buffer[used++] = c;
+    buffer[used] = '\0';
+  }
+  return *this;
+}
+
+TextBuffer &TextBuffer::printf(const char *format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(buffer + used, capacity - used, format, args);
+  va_end(args);
+  if (written > 0)
+  {
+    used = min(used + written, capacity - 1);
+  }
+  return *this;
+}
+
+const char *TextBuffer::c_str() const
+{
+  return buffer;
+}
+
+size_t TextBuffer::length() const
+{
+  return used;
+}
+
+boolean TextBuffer::isFull() const
+{
+  return used + 1 >= capacity;
+}
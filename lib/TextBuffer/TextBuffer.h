@@ -0,0 +1,41 @@
+#ifndef _TEXT_BUFFER_H_
+#define _TEXT_BUFFER_H_
+
+#include <Arduino.h>
+
+// Builds text in memory owned by someone else, usually a Text<N> on the
+// stack. Output that does not fit is cut off, the text stays terminated.
+class TextBuffer
+{
+public:
+  TextBuffer(char *buffer, size_t capacity);
+
+  void clear();
+  TextBuffer &print(const char *text);
+  TextBuffer &print(char c);
+  TextBuffer &printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+  const char *c_str() const;
+  size_t length() const;
+  boolean isFull() const;
+
+private:
+  char *buffer;
+  size_t capacity;
+  size_t used = 0;
+};
+
+// Text of at most N - 1 characters, without any heap allocation
+template <size_t N>
+class Text : public TextBuffer
+{
+public:
+  Text() : TextBuffer(storage, N) {}
+  Text(const Text &) = delete;
+  Text &operator=(const Text &) = delete;
+
+private:
+  char storage[N];
+};
+
+#endif
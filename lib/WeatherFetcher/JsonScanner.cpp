@@ -0,0 +1,257 @@
+#include "JsonScanner.h"
+
+void JsonScanner::reset()
+{
+  state = SCAN_VALUE;
+  inKey = false;
+  key = 0;
+  depth = 0;
+  closed = false;
+  unbalanced = false;
+  skipDepth = 0;
+  arrays = 0;
+  length = 0;
+}
+
+void JsonScanner::parse(char c)
+{
+  switch (state)
+  {
+  case SCAN_STRING:
+    if (c == '\\')
+    {
+      state = SCAN_ESCAPE;
+    }
+    else if (c == '"')
+    {
+      endString();
+    }
+    else
+    {
+      append(c);
+    }
+    return;
+  case SCAN_ESCAPE:
+    state = SCAN_STRING;
+    switch (c)
+    {
+    case 'u':
+      state = SCAN_UNICODE;
+      codePoint = 0;
+      hexDigits = 0;
+      break;
+    case 'n':
+      append('\n');
+      break;
+    case 't':
+      append('\t');
+      break;
+    case 'r':
+      append('\r');
+      break;
+    case 'b':
+      append('\b');
+      break;
+    case 'f':
+      append('\f');
+      break;
+    default:
+      append(c);
+      break;
+    }
+    return;
+  case SCAN_UNICODE:
+    codePoint = codePoint << 4 | (c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+    if (++hexDigits == 4)
+    {
+      appendCodePoint(codePoint);
+      state = SCAN_STRING;
+    }
+    return;
+  case SCAN_LITERAL:
+    if (c != ',' && c != '}' && c != ']' && c != ' ' && c != '\t' && c != '\r' && c != '\n')
+    {
+      append(c);
+      return;
+    }
+    endLiteral();
+    state = SCAN_VALUE;
+    break;
+  default:
+    break;
+  }
+
+  if (skipDepth > 0)
+  {
+    // only strings and nesting matter until the skipped container closes
+    if (c == '"')
+    {
+      state = SCAN_STRING;
+    }
+    else if (c == '{' || c == '[')
+    {
+      depth++;
+    }
+    else if (c == '}' || c == ']')
+    {
+      depth--;
+      if (depth < skipDepth)
+      {
+        skipDepth = 0;
+      }
+      closed = depth == 0;
+    }
+    return;
+  }
+
+  switch (c)
+  {
+  case ' ':
+  case '\t':
+  case '\r':
+  case '\n':
+  case ':':
+    break;
+  case '"':
+    inKey = state == SCAN_KEY;
+    keyHash = jsonKey("");
+    length = 0;
+    state = SCAN_STRING;
+    break;
+  case ',':
+    state = depth > 0 && !(arrays & 1 << (depth - 1)) ? SCAN_KEY : SCAN_VALUE;
+    break;
+  case '{':
+  case '[':
+    push(c == '[');
+    break;
+  case '}':
+  case ']':
+    pop();
+    state = SCAN_VALUE;
+    break;
+  default:
+    length = 0;
+    append(c);
+    state = SCAN_LITERAL;
+    break;
+  }
+}
+
+boolean JsonScanner::isComplete() const
+{
+  return closed && !unbalanced;
+}
+
+void JsonScanner::skipContainer()
+{
+  skipDepth = depth;
+}
+
+void JsonScanner::push(boolean array)
+{
+  uint32_t containerKey = currentKey();
+  uint32_t parent = parentKey();
+  closed = false;
+  depth++;
+  if (depth > JSON_SCANNER_DEPTH)
+  {
+    skipDepth = depth;
+    return;
+  }
+  keys[depth - 1] = containerKey;
+  if (array)
+  {
+    arrays |= 1 << (depth - 1);
+  }
+  else
+  {
+    arrays &= ~(1 << (depth - 1));
+  }
+  state = array ? SCAN_VALUE : SCAN_KEY;
+  startContainer(containerKey, parent, array);
+}
+
+void JsonScanner::pop()
+{
+  if (depth == 0)
+  {
+    unbalanced = true;
+    return;
+  }
+  uint32_t containerKey = keys[depth - 1];
+  boolean array = arrays & 1 << (depth - 1);
+  depth--;
+  closed = depth == 0;
+  endContainer(containerKey, parentKey(), array);
+}
+
+void JsonScanner::endLiteral()
+{
+  text[length] = '\0';
+  value(currentKey(), parentKey(), text, false);
+}
+
+void JsonScanner::endString()
+{
+  state = SCAN_VALUE;
+  if (skipDepth > 0)
+  {
+    return;
+  }
+  if (inKey)
+  {
+    key = keyHash;
+    inKey = false;
+    return;
+  }
+  text[length] = '\0';
+  value(currentKey(), parentKey(), text, true);
+}
+
+void JsonScanner::append(char c)
+{
+  if (skipDepth > 0)
+  {
+    return;
+  }
+  if (inKey)
+  {
+    keyHash = (keyHash ^ (uint8_t)c) * 16777619u;
+  }
+  else if (length < JSON_SCANNER_VALUE_SIZE - 1)
+  {
+    text[length++] = c;
+  }
+}
+
+void JsonScanner::appendCodePoint(uint16_t codePoint)
+{
+  // UTF-8, surrogate pairs come out as two separate characters
+  if (codePoint < 0x80)
+  {
+    append(codePoint);
+  }
+  else if (codePoint < 0x800)
+  {
+    append(0xC0 | codePoint >> 6);
+    append(0x80 | (codePoint & 0x3F));
+  }
+  else
+  {
+    append(0xE0 | codePoint >> 12);
+    append(0x80 | (codePoint >> 6 & 0x3F));
+    append(0x80 | (codePoint & 0x3F));
+  }
+}
+
+// inside arrays the key of the array
+uint32_t JsonScanner::currentKey() const
+{
+  return depth > 0 && (arrays & 1 << (depth - 1)) ? keys[depth - 1] : key;
+}
+
+uint32_t JsonScanner::parentKey() const
+{
+  return depth > 0 ? keys[depth - 1] : 0;
+}
@@ -0,0 +1,84 @@
+#ifndef _JSON_SCANNER_H_
+#define _JSON_SCANNER_H_
+
+#include <Arduino.h>
+
+// Deepest nesting followed, anything below is skipped
+#ifndef JSON_SCANNER_DEPTH
+#define JSON_SCANNER_DEPTH 8
+#endif
+
+// Longest scalar kept, longer ones are cut
+#ifndef JSON_SCANNER_VALUE_SIZE
+#define JSON_SCANNER_VALUE_SIZE 64
+#endif
+
+// FNV-1a of a key, usable as a case label
+constexpr uint32_t jsonKey(const char *name, uint32_t hash = 2166136261u)
+{
+  return *name ? jsonKey(name + 1, (hash ^ (uint8_t)*name) * 16777619u) : hash;
+}
+
+// Streaming JSON tokenizer that never allocates. Keys are only hashed, never
+// stored, and scalars land in a fixed buffer. Each container remembers the
+// key it belongs to, elements of an array share the key of the array. A
+// subclass can skip the rest of a container it is not interested in.
+class JsonScanner
+{
+public:
+  void reset();
+  void parse(char c);
+  // The top level container has closed and no bracket closed more than was
+  // open, i.e. the document arrived whole
+  boolean isComplete() const;
+
+protected:
+  // parent is the key of the enclosing container, 0 at the top level
+  virtual void startContainer(uint32_t key, uint32_t parent, boolean array) {}
+  virtual void endContainer(uint32_t key, uint32_t parent, boolean array) {}
+  // text is terminated, quoted strings are unescaped
+  virtual void value(uint32_t key, uint32_t parent, const char *text, boolean string) = 0;
+  // Ignores everything up to the end of the current container, its
+  // endContainer() is not reported either
+  void skipContainer();
+
+private:
+  enum State : uint8_t
+  {
+    SCAN_VALUE,
+    SCAN_KEY,
+    SCAN_STRING,
+    SCAN_ESCAPE,
+    SCAN_UNICODE,
+    SCAN_LITERAL
+  };
+
+  void push(boolean array);
+  void pop();
+  void endLiteral();
+  void endString();
+  void append(char c);
+  void appendCodePoint(uint16_t codePoint);
+  uint32_t currentKey() const;
+  uint32_t parentKey() const;
+
+  State state = SCAN_VALUE;
+  // the string being read is a key, its hash is built on the fly
+  boolean inKey = false;
+  uint32_t key = 0;
+  uint32_t keyHash = 0;
+  uint8_t depth = 0;
+  boolean closed = false;
+  boolean unbalanced = false;
+  // depth at which skipping ends, 0 when not skipping
+  uint8_t skipDepth = 0;
+  uint32_t keys[JSON_SCANNER_DEPTH];
+  // bit per depth, set for arrays
+  uint16_t arrays = 0;
+  char text[JSON_SCANNER_VALUE_SIZE];
+  uint8_t length = 0;
+  uint16_t codePoint = 0;
+  uint8_t hexDigits = 0;
+};
+
+#endif
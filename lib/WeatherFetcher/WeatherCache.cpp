@@ -0,0 +1,87 @@
+#include "WeatherCache.h"
+
+// "WXC" and the format version
+static const uint32_t WEATHER_CACHE_MAGIC = 0x57584300 | WEATHER_CACHE_FORMAT;
+
+WeatherCache::WeatherCache(FS &fs, const char *path) : fs(fs), path(path)
+{
+}
+
+boolean WeatherCache::save(const WeatherModel &model, const String &key, uint32_t fetchedAt)
+{
+  String temporary = String(path) + ".tmp";
+  File file = fs.open(temporary, "w");
+  if (!file)
+  {
+    Serial.printf("Weather cache: cannot write %s\n", temporary.c_str());
+    return false;
+  }
+  Header header = {WEATHER_CACHE_MAGIC, hash(key), fetchedAt, sizeof(WeatherModel), model.forecastCount, 0};
+  file.write((const uint8_t *)&header, sizeof(header));
+  // forecasts past the count are empty, the string pool is short
+  file.write((const uint8_t *)&model, offsetof(WeatherModel, forecasts) + model.forecastCount * sizeof(ForecastWeather));
+  file.write((const uint8_t *)&model.forecastCount, sizeof(WeatherModel) - offsetof(WeatherModel, forecastCount));
+  // the magic goes last as well, a short write shows up as a missing trailer
+  file.write((const uint8_t *)&WEATHER_CACHE_MAGIC, sizeof(WEATHER_CACHE_MAGIC));
+  size_t size = file.size();
+  file.close();
+
+  // SPIFFS cannot rename onto an existing file
+  fs.remove(path);
+  if (!fs.rename(temporary.c_str(), path))
+  {
+    Serial.printf("Weather cache: cannot rename %s\n", temporary.c_str());
+    return false;
+  }
+  Serial.printf("Weather cache: saved %u bytes\n", (unsigned)size);
+  return true;
+}
+
+boolean WeatherCache::load(WeatherModel *model, const String &key, uint32_t *fetchedAt)
+{
+  File file = fs.open(path, "r");
+  if (!file)
+  {
+    return false;
+  }
+  Header header;
+  if (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) || header.magic != WEATHER_CACHE_MAGIC ||
+      header.keyHash != hash(key) || header.modelSize != sizeof(WeatherModel) || header.forecastCount > MAX_FORECASTS)
+  {
+    Serial.println("Weather cache: outdated, ignored");
+    return false;
+  }
+
+  *model = WeatherModel();
+  size_t head = offsetof(WeatherModel, forecasts) + header.forecastCount * sizeof(ForecastWeather);
+  size_t tail = sizeof(WeatherModel) - offsetof(WeatherModel, forecastCount);
+  uint32_t magic = 0;
+  boolean ok = file.read((uint8_t *)model, head) == head &&
+               file.read((uint8_t *)&model->forecastCount, tail) == tail &&
+               file.read((uint8_t *)&magic, sizeof(magic)) == sizeof(magic) &&
+               magic == WEATHER_CACHE_MAGIC && model->forecastCount == header.forecastCount;
+  file.close();
+  if (!ok)
+  {
+    Serial.println("Weather cache: truncated, ignored");
+    return false;
+  }
+  *fetchedAt = header.fetchedAt;
+  return true;
+}
+
+void WeatherCache::clear()
+{
+  fs.remove(path);
+}
+
+// FNV-1a
+uint32_t WeatherCache::hash(const String &key)
+{
+  uint32_t value = 2166136261u;
+  for (const char *c = key.c_str(); *c; c++)
+  {
+    value = (value ^ (uint8_t)*c) * 16777619u;
+  }
+  return value;
+}
@@ -0,0 +1,44 @@
+#ifndef _WEATHER_CACHE_H_
+#define _WEATHER_CACHE_H_
+
+#include <Arduino.h>
+#include <FS.h>
+#include "WeatherModel.h"
+
+// Bump whenever the file layout changes
+#define WEATHER_CACHE_FORMAT 2
+
+// Keeps the last downloaded model on flash so a reboot has something to
+// show before WiFi and NTP are up. The file holds a small header followed
+// by the model as it is in memory, only up to the forecasts in use. The key
+// names what the model was downloaded for (location, language, units), a
+// file written for another key or by another build of the model is ignored.
+class WeatherCache
+{
+public:
+  WeatherCache(FS &fs, const char *path = "/weather.bin");
+
+  // Writes to a temporary file first, a reset while saving keeps the old one
+  boolean save(const WeatherModel &model, const String &key, uint32_t fetchedAt);
+  // False if there is no usable file, model may be partly filled then
+  boolean load(WeatherModel *model, const String &key, uint32_t *fetchedAt);
+  void clear();
+
+private:
+  struct Header
+  {
+    uint32_t magic;
+    uint32_t keyHash;
+    uint32_t fetchedAt;
+    uint16_t modelSize;
+    uint8_t forecastCount;
+    uint8_t reserved;
+  };
+
+  static uint32_t hash(const String &key);
+
+  FS &fs;
+  const char *path;
+};
+
+#endif
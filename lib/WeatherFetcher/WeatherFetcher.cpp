@@ -0,0 +1,235 @@
+#include "WeatherFetcher.h"
+
+WeatherFetcher::WeatherFetcher()
+{
+  front = &models[0];
+  back = &models[1];
+  *front = WeatherModel();
+}
+
+void WeatherFetcher::setServer(const String &host, uint16_t port)
+{
+  this->host = host;
+  this->port = port;
+}
+
+void WeatherFetcher::setLocation(const String &appId, const String &locationId)
+{
+  this->appId = appId;
+  this->locationId = locationId;
+}
+
+void WeatherFetcher::setLanguage(const String &language)
+{
+  this->language = language;
+}
+
+void WeatherFetcher::setMetric(boolean metric)
+{
+  this->metric = metric;
+}
+
+void WeatherFetcher::setAllowedHours(const uint8_t *hours, uint8_t count)
+{
+  parser.setAllowedHours(hours, count);
+}
+
+void WeatherFetcher::start()
+{
+  if (state != WEATHER_IDLE)
+  {
+    return;
+  }
+  // fields missing from the responses must not survive from older data
+  *back = WeatherModel();
+  request = 0;
+  setState(WEATHER_CONNECTING);
+}
+
+boolean WeatherFetcher::update(uint16_t budget)
+{
+  uint32_t published = version;
+  unsigned long start = millis();
+  while (state != WEATHER_IDLE && millis() - start < budget)
+  {
+    if (millis() - requestStart > WEATHER_FETCH_TIMEOUT)
+    {
+      fail("timeout");
+      break;
+    }
+    if (!step())
+    {
+      break;
+    }
+  }
+  return version != published;
+}
+
+boolean WeatherFetcher::isBusy() const
+{
+  return state != WEATHER_IDLE;
+}
+
+uint8_t WeatherFetcher::getProgress() const
+{
+  if (state == WEATHER_IDLE)
+  {
+    return 100;
+  }
+  return 10 + request * 45 + (state - WEATHER_CONNECTING) * 10;
+}
+
+const WeatherModel *WeatherFetcher::getModel() const
+{
+  return front;
+}
+
+uint32_t WeatherFetcher::getVersion() const
+{
+  return version;
+}
+
+boolean WeatherFetcher::step()
+{
+  switch (state)
+  {
+  case WEATHER_CONNECTING:
+    // the only blocking part, bounded by WEATHER_CONNECT_TIMEOUT. The ESP32
+    // core takes setTimeout() in seconds, its connect() takes milliseconds.
+#ifdef ESP32
+    if (!client.connect(host.c_str(), port, WEATHER_CONNECT_TIMEOUT))
+#else
+    client.setTimeout(WEATHER_CONNECT_TIMEOUT);
+    if (!client.connect(host.c_str(), port))
+#endif
+    {
+      fail("connection failed");
+      return false;
+    }
+    setState(WEATHER_SENDING);
+    return true;
+  case WEATHER_SENDING:
+    // HTTP/1.0 keeps the body free of chunked transfer encoding
+    client.print("GET " + getPath() + " HTTP/1.0\r\nHost: " + host + "\r\nConnection: close\r\n\r\n");
+    setState(WEATHER_HEADERS);
+    return true;
+  case WEATHER_HEADERS:
+  case WEATHER_BODY:
+    break;
+  default:
+    return false;
+  }
+
+  int available = client.available();
+  if (available <= 0)
+  {
+    if (!client.connected())
+    {
+      finishRequest();
+      return true;
+    }
+    return false;
+  }
+
+  uint8_t buffer[128];
+  int length = client.read(buffer, min(available, (int)sizeof(buffer)));
+  for (int i = 0; i < length; i++)
+  {
+    char c = buffer[i];
+    if (state == WEATHER_BODY)
+    {
+      parser.parse(c);
+      continue;
+    }
+    // status code from "HTTP/1.x 200 OK", then skip to the empty line
+    if (statusPos < 12)
+    {
+      if (statusPos >= 9 && c >= '0' && c <= '9')
+      {
+        status = status * 10 + c - '0';
+      }
+      statusPos++;
+    }
+    headerEndPos = c == (headerEndPos % 2 == 0 ? '\r' : '\n') ? headerEndPos + 1 : (c == '\r' ? 1 : 0);
+    if (headerEndPos == 4)
+    {
+      if (status != 200)
+      {
+        Serial.printf("Weather request failed with HTTP %d\n", status);
+        fail("bad status");
+        return false;
+      }
+      setState(WEATHER_BODY);
+    }
+  }
+  return true;
+}
+
+String WeatherFetcher::getPath() const
+{
+  return String(request == 0 ? "/data/2.5/weather" : "/data/2.5/forecast") +
+         "?id=" + locationId + "&appid=" + appId + "&units=" + (metric ? "metric" : "imperial") +
+         "&lang=" + language;
+}
+
+void WeatherFetcher::setState(WeatherFetchState state)
+{
+  this->state = state;
+  switch (state)
+  {
+  case WEATHER_CONNECTING:
+    requestStart = millis();
+    break;
+  case WEATHER_HEADERS:
+    status = 0;
+    statusPos = 0;
+    headerEndPos = 0;
+    break;
+  case WEATHER_BODY:
+    parser.begin(back, request == 1);
+    break;
+  default:
+    break;
+  }
+}
+
+void WeatherFetcher::finishRequest()
+{
+  client.stop();
+  if (state != WEATHER_BODY)
+  {
+    fail("connection closed");
+    return;
+  }
+  // HTTP/1.0 ends the body by closing, a dropped connection looks the same
+  if (!parser.isComplete())
+  {
+    fail("truncated");
+    return;
+  }
+  if (request == 0)
+  {
+    request = 1;
+    setState(WEATHER_CONNECTING);
+    return;
+  }
+  publish();
+}
+
+void WeatherFetcher::fail(const char *reason)
+{
+  Serial.printf("Weather refresh aborted: %s\n", reason);
+  client.stop();
+  setState(WEATHER_IDLE);
+}
+
+void WeatherFetcher::publish()
+{
+  // a single pointer store, readers never see a half parsed model
+  WeatherModel *shown = front;
+  front = back;
+  back = shown;
+  version++;
+  setState(WEATHER_IDLE);
+  Serial.printf("Weather refreshed, %d forecasts\n", front->forecastCount);
+}
@@ -0,0 +1,95 @@
+#ifndef _WEATHER_FETCHER_H_
+#define _WEATHER_FETCHER_H_
+
+#include <Arduino.h>
+#if defined(ESP32) || defined(NATIVE)
+#include <WiFi.h>
+#endif
+#ifdef ESP8266
+#include <ESP8266WiFi.h>
+#endif
+#include "WeatherModel.h"
+#include "WeatherParser.h"
+
+// A refresh that did not finish within this time is dropped
+#ifndef WEATHER_FETCH_TIMEOUT
+#define WEATHER_FETCH_TIMEOUT 15000
+#endif
+
+// Upper bound for the blocking TCP connect, DNS lookup included
+#ifndef WEATHER_CONNECT_TIMEOUT
+#define WEATHER_CONNECT_TIMEOUT 5000
+#endif
+
+enum WeatherFetchState
+{
+  WEATHER_IDLE,
+  WEATHER_CONNECTING,
+  WEATHER_SENDING,
+  WEATHER_HEADERS,
+  WEATHER_BODY
+};
+
+// Downloads current conditions and forecasts in small steps so the caller
+// can keep drawing in between. Responses are parsed into a shadow model
+// which only replaces the shown one once both requests succeeded.
+class WeatherFetcher
+{
+public:
+  WeatherFetcher();
+
+  void setServer(const String &host, uint16_t port);
+  void setLocation(const String &appId, const String &locationId);
+  void setLanguage(const String &language);
+  void setMetric(boolean metric);
+  void setAllowedHours(const uint8_t *hours, uint8_t count);
+
+  // Starts a refresh unless one is running already
+  void start();
+  // Works on the refresh for about budget ms at most and returns early when
+  // waiting for the network. True when a new model was just published.
+  boolean update(uint16_t budget);
+  boolean isBusy() const;
+  // Rough progress of the running refresh in percent
+  uint8_t getProgress() const;
+
+  // The last complete model, stays valid until the next publish
+  const WeatherModel *getModel() const;
+  // Incremented on every publish
+  uint32_t getVersion() const;
+
+private:
+  // Does one unit of work, false if there was nothing to do right now
+  boolean step();
+  String getPath() const;
+  void setState(WeatherFetchState state);
+  void finishRequest();
+  void fail(const char *reason);
+  void publish();
+
+  WiFiClient client;
+  WeatherParser parser;
+
+  String host = "api.openweathermap.org";
+  uint16_t port = 80;
+  String appId;
+  String locationId;
+  String language = "en";
+  boolean metric = true;
+
+  WeatherModel models[2];
+  WeatherModel *front;
+  WeatherModel *back;
+  uint32_t version = 0;
+
+  WeatherFetchState state = WEATHER_IDLE;
+  // 0 for current conditions, 1 for forecasts
+  uint8_t request = 0;
+  unsigned long requestStart = 0;
+  uint16_t status = 0;
+  // position in the status line and in the "\r\n\r\n" header terminator
+  uint8_t statusPos = 0;
+  uint8_t headerEndPos = 0;
+};
+
+#endif
@@ -0,0 +1,45 @@
+#include "WeatherModel.h"
+
+WeatherIcon parseWeatherIcon(const char *code)
+{
+  // "01d": two digit condition, then day or night
+  if (strlen(code) != 3 || (code[2] != 'd' && code[2] != 'n'))
+  {
+    return WEATHER_ICON_UNKNOWN;
+  }
+  static const uint8_t CONDITIONS[] = {1, 2, 3, 4, 9, 10, 11, 13, 50};
+  uint8_t condition = (code[0] - '0') * 10 + code[1] - '0';
+  for (uint8_t i = 0; i < sizeof(CONDITIONS); i++)
+  {
+    if (CONDITIONS[i] == condition)
+    {
+      return (WeatherIcon)(WEATHER_ICON_CLEAR_DAY + i * 2 + (code[2] == 'n'));
+    }
+  }
+  return WEATHER_ICON_UNKNOWN;
+}
+
+uint16_t WeatherModel::intern(const char *text)
+{
+  if (*text == '\0')
+  {
+    return 0;
+  }
+  // the pool is short, a linear search is fine
+  for (uint16_t offset = 1; offset < stringsUsed; offset += strlen(strings + offset) + 1)
+  {
+    if (strcmp(strings + offset, text) == 0)
+    {
+      return offset;
+    }
+  }
+  uint16_t start = max(stringsUsed, (uint16_t)1);
+  size_t length = strlen(text);
+  if (start + length + 1 > sizeof(strings))
+  {
+    return 0;
+  }
+  memcpy(strings + start, text, length + 1);
+  stringsUsed = start + length + 1;
+  return start;
+}
@@ -0,0 +1,106 @@
+#ifndef _WEATHER_MODEL_H_
+#define _WEATHER_MODEL_H_
+
+#include <Arduino.h>
+
+// One per 3 hours over 5 days, the whole forecast document
+#ifndef MAX_FORECASTS
+#define MAX_FORECASTS 40
+#endif
+
+// Room for the texts of one model, each distinct text is stored once
+#ifndef WEATHER_STRING_POOL_SIZE
+#define WEATHER_STRING_POOL_SIZE 384
+#endif
+
+// OpenWeatherMap icon codes, "01d" to "50n"
+enum WeatherIcon : uint8_t
+{
+  WEATHER_ICON_UNKNOWN,
+  WEATHER_ICON_CLEAR_DAY,
+  WEATHER_ICON_CLEAR_NIGHT,
+  WEATHER_ICON_FEW_CLOUDS_DAY,
+  WEATHER_ICON_FEW_CLOUDS_NIGHT,
+  WEATHER_ICON_SCATTERED_CLOUDS_DAY,
+  WEATHER_ICON_SCATTERED_CLOUDS_NIGHT,
+  WEATHER_ICON_BROKEN_CLOUDS_DAY,
+  WEATHER_ICON_BROKEN_CLOUDS_NIGHT,
+  WEATHER_ICON_SHOWER_RAIN_DAY,
+  WEATHER_ICON_SHOWER_RAIN_NIGHT,
+  WEATHER_ICON_RAIN_DAY,
+  WEATHER_ICON_RAIN_NIGHT,
+  WEATHER_ICON_THUNDERSTORM_DAY,
+  WEATHER_ICON_THUNDERSTORM_NIGHT,
+  WEATHER_ICON_SNOW_DAY,
+  WEATHER_ICON_SNOW_NIGHT,
+  WEATHER_ICON_MIST_DAY,
+  WEATHER_ICON_MIST_NIGHT,
+  WEATHER_ICON_COUNT
+};
+
+WeatherIcon parseWeatherIcon(const char *code);
+
+// Fixed point: temperatures and wind speeds in tenths of the configured
+// unit, rain in hundredths. Texts are offsets into the string pool.
+
+struct CurrentWeather
+{
+  float lon;
+  float lat;
+  uint32_t observationTime;
+  uint32_t sunrise;
+  uint32_t sunset;
+  int16_t temp;
+  int16_t tempMin;
+  int16_t tempMax;
+  int16_t windSpeed;
+  uint16_t windDeg;
+  uint16_t pressure;
+  uint16_t visibility;
+  uint16_t weatherId;
+  uint8_t humidity;
+  uint8_t clouds;
+  WeatherIcon icon;
+  uint16_t main;
+  uint16_t description;
+  uint16_t country;
+  uint16_t cityName;
+};
+
+struct ForecastWeather
+{
+  uint32_t observationTime;
+  int16_t temp;
+  int16_t feelsLike;
+  int16_t tempMin;
+  int16_t tempMax;
+  int16_t windSpeed;
+  uint16_t windDeg;
+  uint16_t pressure;
+  uint16_t rain;
+  uint16_t weatherId;
+  uint8_t humidity;
+  uint8_t clouds;
+  WeatherIcon icon;
+  uint16_t main;
+  uint16_t description;
+};
+
+// Everything one refresh downloads. The display reads one instance while
+// the next refresh is parsed into another one. Plain data without pointers,
+// copies and the flash cache take it byte by byte.
+struct WeatherModel
+{
+  CurrentWeather current;
+  ForecastWeather forecasts[MAX_FORECASTS];
+  uint8_t forecastCount;
+  uint16_t stringsUsed;
+  char strings[WEATHER_STRING_POOL_SIZE];
+
+  // Offset of text in the pool, added unless there already. Offset 0 is the
+  // empty string, also returned when the pool is full.
+  uint16_t intern(const char *text);
+  const char *text(uint16_t offset) const { return strings + offset; }
+};
+
+#endif
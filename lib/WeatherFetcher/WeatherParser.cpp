@@ -0,0 +1,279 @@
+#include "WeatherParser.h"
+#include <time.h>
+
+void WeatherParser::begin(WeatherModel *model, boolean forecast)
+{
+  this->model = model;
+  this->forecast = forecast;
+  reset();
+  weatherItemCounter = 0;
+  forecastAllowed = false;
+  if (forecast)
+  {
+    model->forecastCount = 0;
+  }
+}
+
+void WeatherParser::setAllowedHours(const uint8_t *hours, uint8_t count)
+{
+  allowedHours = hours;
+  allowedHoursCount = count;
+}
+
+void WeatherParser::startContainer(uint32_t key, uint32_t parent, boolean array)
+{
+  // a forecast entry, its "dt" decides whether it is read at all
+  if (forecast && key == jsonKey("list") && !array)
+  {
+    weatherItemCounter = 0;
+    forecastAllowed = false;
+    if (model->forecastCount >= MAX_FORECASTS)
+    {
+      skipContainer();
+    }
+  }
+}
+
+void WeatherParser::endContainer(uint32_t key, uint32_t parent, boolean array)
+{
+  if (array)
+  {
+    return;
+  }
+  if (key == jsonKey("weather"))
+  {
+    weatherItemCounter++;
+  }
+  else if (forecast && key == jsonKey("list") && forecastAllowed)
+  {
+    model->forecastCount++;
+    forecastAllowed = false;
+  }
+}
+
+void WeatherParser::value(uint32_t key, uint32_t parent, const char *text, boolean string)
+{
+  if (forecast)
+  {
+    forecastValue(key, parent, text);
+  }
+  else
+  {
+    currentValue(key, parent, text);
+  }
+}
+
+void WeatherParser::currentValue(uint32_t key, uint32_t parent, const char *text)
+{
+  CurrentWeather &data = model->current;
+  // only the first entry of the "weather" array is shown
+  if (parent == jsonKey("weather"))
+  {
+    if (weatherItemCounter > 0)
+    {
+      return;
+    }
+    switch (key)
+    {
+    case jsonKey("id"):
+      data.weatherId = atoi(text);
+      break;
+    case jsonKey("main"):
+      data.main = model->intern(text);
+      break;
+    case jsonKey("description"):
+      data.description = model->intern(text);
+      break;
+    case jsonKey("icon"):
+      data.icon = parseWeatherIcon(text);
+      break;
+    }
+    return;
+  }
+  switch (key)
+  {
+  case jsonKey("lon"):
+    data.lon = atof(text);
+    break;
+  case jsonKey("lat"):
+    data.lat = atof(text);
+    break;
+  case jsonKey("temp"):
+    data.temp = parseFixed(text, 1);
+    break;
+  case jsonKey("pressure"):
+    data.pressure = atoi(text);
+    break;
+  case jsonKey("humidity"):
+    data.humidity = atoi(text);
+    break;
+  case jsonKey("temp_min"):
+    data.tempMin = parseFixed(text, 1);
+    break;
+  case jsonKey("temp_max"):
+    data.tempMax = parseFixed(text, 1);
+    break;
+  case jsonKey("visibility"):
+    data.visibility = atoi(text);
+    break;
+  case jsonKey("speed"):
+    data.windSpeed = parseFixed(text, 1);
+    break;
+  case jsonKey("deg"):
+    data.windDeg = atoi(text);
+    break;
+  case jsonKey("all"):
+    data.clouds = atoi(text);
+    break;
+  case jsonKey("dt"):
+    data.observationTime = atol(text);
+    break;
+  case jsonKey("country"):
+    data.country = model->intern(text);
+    break;
+  case jsonKey("sunrise"):
+    data.sunrise = atol(text);
+    break;
+  case jsonKey("sunset"):
+    data.sunset = atol(text);
+    break;
+  case jsonKey("name"):
+    data.cityName = model->intern(text);
+    break;
+  }
+}
+
+void WeatherParser::forecastValue(uint32_t key, uint32_t parent, const char *text)
+{
+  if (model->forecastCount >= MAX_FORECASTS)
+  {
+    return;
+  }
+  ForecastWeather &data = model->forecasts[model->forecastCount];
+  // "dt" comes first in a list entry, the rest is skipped if its hour is not wanted
+  if (key == jsonKey("dt") && parent == jsonKey("list"))
+  {
+    time_t time = atol(text);
+    if (!isAllowedHour(time))
+    {
+      skipContainer();
+      return;
+    }
+    forecastAllowed = true;
+    data.observationTime = time;
+    data.rain = 0;
+    return;
+  }
+  if (!forecastAllowed)
+  {
+    return;
+  }
+  if (parent == jsonKey("weather"))
+  {
+    if (weatherItemCounter > 0)
+    {
+      return;
+    }
+    switch (key)
+    {
+    case jsonKey("id"):
+      data.weatherId = atoi(text);
+      break;
+    case jsonKey("main"):
+      data.main = model->intern(text);
+      break;
+    case jsonKey("description"):
+      data.description = model->intern(text);
+      break;
+    case jsonKey("icon"):
+      data.icon = parseWeatherIcon(text);
+      break;
+    }
+    return;
+  }
+  switch (key)
+  {
+  case jsonKey("temp"):
+    data.temp = parseFixed(text, 1);
+    break;
+  case jsonKey("feels_like"):
+    data.feelsLike = parseFixed(text, 1);
+    break;
+  case jsonKey("temp_min"):
+    data.tempMin = parseFixed(text, 1);
+    break;
+  case jsonKey("temp_max"):
+    data.tempMax = parseFixed(text, 1);
+    break;
+  case jsonKey("pressure"):
+    data.pressure = atoi(text);
+    break;
+  case jsonKey("humidity"):
+    data.humidity = atoi(text);
+    break;
+  case jsonKey("all"):
+    data.clouds = atoi(text);
+    break;
+  case jsonKey("speed"):
+    data.windSpeed = parseFixed(text, 1);
+    break;
+  case jsonKey("deg"):
+    data.windDeg = atoi(text);
+    break;
+  case jsonKey("3h"):
+    if (parent == jsonKey("rain"))
+    {
+      data.rain = parseFixed(text, 2);
+    }
+    break;
+  }
+}
+
+// "-12.34" with decimals 1 is -123, rounded half away from zero
+int32_t WeatherParser::parseFixed(const char *text, uint8_t decimals)
+{
+  boolean negative = *text == '-';
+  if (negative)
+  {
+    text++;
+  }
+  int32_t value = 0;
+  for (; *text >= '0' && *text <= '9'; text++)
+  {
+    value = value * 10 + *text - '0';
+  }
+  if (*text == '.')
+  {
+    text++;
+  }
+  for (uint8_t i = 0; i < decimals; i++)
+  {
+    value *= 10;
+    if (*text >= '0' && *text <= '9')
+    {
+      value += *text++ - '0';
+    }
+  }
+  if (*text >= '5' && *text <= '9')
+  {
+    value++;
+  }
+  return negative ? -value : value;
+}
+
+boolean WeatherParser::isAllowedHour(time_t time) const
+{
+  if (allowedHoursCount == 0)
+  {
+    return true;
+  }
+  uint8_t hour = gmtime(&time)->tm_hour;
+  for (uint8_t i = 0; i < allowedHoursCount; i++)
+  {
+    if (allowedHours[i] == hour)
+    {
+      return true;
+    }
+  }
+  return false;
+}
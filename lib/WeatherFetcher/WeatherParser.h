@@ -0,0 +1,37 @@
+#ifndef _WEATHER_PARSER_H_
+#define _WEATHER_PARSER_H_
+
+#include "JsonScanner.h"
+#include "WeatherModel.h"
+
+// Fills a WeatherModel from the OpenWeatherMap current weather or 5 day
+// forecast documents, mapping the same fields the ThingPulse clients do.
+// Keys are matched by hash, forecast entries for hours that are not wanted
+// are skipped as soon as their "dt" is known.
+class WeatherParser : public JsonScanner
+{
+public:
+  void begin(WeatherModel *model, boolean forecast);
+  // Only forecasts for these UTC hours are kept, all of them if count is 0
+  void setAllowedHours(const uint8_t *hours, uint8_t count);
+
+protected:
+  void startContainer(uint32_t key, uint32_t parent, boolean array);
+  void endContainer(uint32_t key, uint32_t parent, boolean array);
+  void value(uint32_t key, uint32_t parent, const char *text, boolean string);
+
+private:
+  void currentValue(uint32_t key, uint32_t parent, const char *text);
+  void forecastValue(uint32_t key, uint32_t parent, const char *text);
+  boolean isAllowedHour(time_t time) const;
+  static int32_t parseFixed(const char *text, uint8_t decimals);
+
+  WeatherModel *model = nullptr;
+  boolean forecast = false;
+  uint8_t weatherItemCounter = 0;
+  boolean forecastAllowed = false;
+  const uint8_t *allowedHours = nullptr;
+  uint8_t allowedHoursCount = 0;
+};
+
+#endif
@@ -0,0 +1,459 @@
+#include "Widgets.h"
+#include <ctype.h>
+
+Widget::Widget(int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+  this->x = x;
+  this->y = y;
+  this->width = width;
+  this->height = height;
+}
+
+boolean Widget::isOutdated()
+{
+  pendingVersion = version();
+  return !valid || pendingVersion != drawnVersion;
+}
+
+boolean Widget::paintsInPlace()
+{
+  return false;
+}
+
+boolean Widget::overlaps(const Widget *other) const
+{
+  return x < other->x + other->width && other->x < x + width &&
+         y < other->y + other->height && other->y < y + height;
+}
+
+void Widget::clear(Canvas *canvas)
+{
+  fillBackground(canvas, x, y, width, height);
+}
+
+// MiniGrafx skips pixels of the transparent color, which bitmaps leave set
+// to the background
+void Widget::fillBackground(Canvas *canvas, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+  int16_t transparentColor = canvas->getTransparentColor();
+  canvas->setTransparentColor(0xFFFF);
+  canvas->setColor(WIDGET_BACKGROUND);
+  canvas->fillRect(x, y, width, height);
+  canvas->setTransparentColor(transparentColor);
+}
+
+boolean Widget::overlapsRows(int16_t top, uint16_t height) const
+{
+  return y < top + height && top < y + this->height;
+}
+
+void Widget::paint(Canvas *canvas)
+{
+  draw(canvas);
+  drawnVersion = pendingVersion;
+  valid = true;
+}
+
+void Widget::repaint(Canvas *canvas)
+{
+  boolean wasValid = valid;
+  valid = false;
+  draw(canvas);
+  valid = wasValid;
+}
+
+void Widget::invalidate()
+{
+  valid = false;
+}
+
+boolean Widget::isValid() const
+{
+  return valid;
+}
+
+Screen::Screen(Widget **widgets, uint8_t count)
+{
+  this->widgets = widgets;
+  this->count = count;
+}
+
+boolean Screen::update(Canvas *canvas)
+{
+  canvas->setBandPainter(this);
+  boolean outdated[count];
+  boolean anyOutdated = false;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    outdated[i] = widgets[i]->isOutdated();
+    anyOutdated |= outdated[i];
+  }
+  if (!anyOutdated)
+  {
+    return false;
+  }
+
+  // clearing a widget also wipes whatever overlapping widgets drew there,
+  // so those have to be repainted as well, and completely
+  boolean clears[count];
+  for (uint8_t i = 0; i < count; i++)
+  {
+    clears[i] = outdated[i] && !widgets[i]->paintsInPlace();
+  }
+  boolean spread = true;
+  while (spread)
+  {
+    spread = false;
+    for (uint8_t i = 0; i < count; i++)
+    {
+      for (uint8_t j = 0; j < count; j++)
+      {
+        if (clears[i] && !clears[j] && widgets[i]->overlaps(widgets[j]))
+        {
+          widgets[j]->invalidate();
+          outdated[j] = true;
+          clears[j] = true;
+          spread = true;
+        }
+      }
+    }
+  }
+
+  // clear everything first so overlapping widgets keep each other's pixels
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (clears[i])
+    {
+      widgets[i]->clear(canvas);
+    }
+  }
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (outdated[i])
+    {
+      widgets[i]->paint(canvas);
+    }
+  }
+  return true;
+}
+
+void Screen::invalidate()
+{
+  for (uint8_t i = 0; i < count; i++)
+  {
+    widgets[i]->invalidate();
+  }
+}
+
+// A band starts out empty, so it gets everything that shows in it, as a
+// full redraw would have drawn it
+void Screen::paintBand(Canvas *canvas, int16_t top, uint16_t height)
+{
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (widgets[i]->overlapsRows(top, height))
+    {
+      widgets[i]->clear(canvas);
+    }
+  }
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (widgets[i]->overlapsRows(top, height))
+    {
+      widgets[i]->repaint(canvas);
+    }
+  }
+}
+
+Label::Label(int16_t x, int16_t y, uint16_t width, uint16_t height, const char *font, uint16_t color,
+             TEXT_ALIGNMENT alignment, TextSource text, VersionSource version) : Widget(x, y, width, height)
+{
+  this->font = font;
+  this->color = color;
+  this->alignment = alignment;
+  this->text = text;
+  this->versionSource = version;
+}
+
+uint32_t Label::version()
+{
+  return versionSource != nullptr ? versionSource() : 0;
+}
+
+void Label::draw(Canvas *canvas)
+{
+  int16_t anchorX = x;
+  if (alignment == TEXT_ALIGN_CENTER || alignment == TEXT_ALIGN_CENTER_BOTH)
+  {
+    anchorX += width / 2;
+  }
+  else if (alignment == TEXT_ALIGN_RIGHT)
+  {
+    anchorX += width;
+  }
+  canvas->setFont(font);
+  canvas->setColor(color);
+  canvas->setTextAlignment(alignment);
+  Text<WIDGET_TEXT_SIZE> buffer;
+  text(buffer);
+  canvas->drawString(anchorX, y, buffer.c_str());
+}
+
+DigitLabel::DigitLabel(int16_t x, int16_t y, uint16_t width, uint16_t height, const char *font, uint16_t color,
+                       TextSource text, VersionSource version) : Widget(x, y, width, height)
+{
+  this->font = font;
+  this->color = color;
+  this->text = text;
+  this->versionSource = version;
+}
+
+uint32_t DigitLabel::version()
+{
+  pending.clear();
+  text(pending);
+  return versionSource != nullptr ? versionSource() : 0;
+}
+
+// Only digits may have changed, everything else keeps its cell
+boolean DigitLabel::paintsInPlace()
+{
+  if (!isValid() || pending.length() != shown.length())
+  {
+    return false;
+  }
+  for (size_t i = 0; i < pending.length(); i++)
+  {
+    char next = pending.c_str()[i];
+    char last = shown.c_str()[i];
+    if (next != last && !(isdigit(next) && isdigit(last)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint16_t DigitLabel::cellWidth(Canvas *canvas, char c)
+{
+  return isdigit(c) ? digitWidth : canvas->getStringWidth(&c, 1);
+}
+
+void DigitLabel::draw(Canvas *canvas)
+{
+  canvas->setFont(font);
+  canvas->setColor(color);
+  canvas->setTextAlignment(TEXT_ALIGN_LEFT);
+  boolean inPlace = paintsInPlace();
+  if (!inPlace)
+  {
+    digitWidth = 0;
+    for (char digit = '0'; digit <= '9'; digit++)
+    {
+      digitWidth = max(digitWidth, canvas->getStringWidth(&digit, 1));
+    }
+  }
+
+  const char *chars = pending.c_str();
+  uint16_t total = 0;
+  for (size_t i = 0; i < pending.length(); i++)
+  {
+    total += cellWidth(canvas, chars[i]);
+  }
+  int16_t left = x + width / 2 - total / 2;
+  for (size_t i = 0; i < pending.length(); i++)
+  {
+    uint16_t cell = cellWidth(canvas, chars[i]);
+    if (!inPlace || chars[i] != shown.c_str()[i])
+    {
+      if (inPlace)
+      {
+        fillBackground(canvas, left, y, cell, height);
+        canvas->setColor(color);
+      }
+      char glyph[] = {chars[i], '\0'};
+      canvas->drawString(left + (cell - canvas->getStringWidth(glyph, 1)) / 2, y, glyph);
+    }
+    left += cell;
+  }
+  shown.clear();
+  shown.print(chars);
+}
+
+ValuePair::ValuePair(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t valueOffset, const char *font,
+                     uint16_t labelColor, uint16_t valueColor, const char *label, TextSource value,
+                     VersionSource version) : Widget(x, y, width, height)
+{
+  this->valueOffset = valueOffset;
+  this->font = font;
+  this->labelColor = labelColor;
+  this->valueColor = valueColor;
+  this->label = label;
+  this->value = value;
+  this->versionSource = version;
+}
+
+uint32_t ValuePair::version()
+{
+  return versionSource != nullptr ? versionSource() : 0;
+}
+
+void ValuePair::draw(Canvas *canvas)
+{
+  canvas->setFont(font);
+  canvas->setTextAlignment(TEXT_ALIGN_LEFT);
+  canvas->setColor(labelColor);
+  canvas->drawString(x, y, label);
+  canvas->setColor(valueColor);
+  Text<WIDGET_TEXT_SIZE> buffer;
+  value(buffer);
+  canvas->drawString(x + valueOffset, y, buffer.c_str());
+}
+
+Icon::Icon(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t transparentColor,
+           BitmapSource bitmap, VersionSource version) : Widget(x, y, width, height)
+{
+  this->transparentColor = transparentColor;
+  this->bitmap = bitmap;
+  this->versionSource = version;
+}
+
+uint32_t Icon::version()
+{
+  return versionSource != nullptr ? versionSource() : 0;
+}
+
+void Icon::draw(Canvas *canvas)
+{
+  canvas->setTransparentColor(transparentColor);
+  canvas->drawPalettedBitmapFromPgm(x, y, bitmap());
+}
+
+ProgressBar::ProgressBar(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t frameColor,
+                         uint16_t barColor, PercentSource percent) : Widget(x, y, width, height)
+{
+  this->frameColor = frameColor;
+  this->barColor = barColor;
+  this->percent = percent;
+}
+
+uint32_t ProgressBar::version()
+{
+  return percent();
+}
+
+void ProgressBar::draw(Canvas *canvas)
+{
+  canvas->setColor(frameColor);
+  canvas->drawRect(x, y, width, height);
+  canvas->setColor(barColor);
+  canvas->fillRect(x + 2, y + 2, (width - 4) * min(percent(), (uint8_t)100) / 100, height - 4);
+}
+
+CarouselWidget::CarouselWidget(int16_t x, int16_t y, uint16_t width, uint16_t height, CarouselFrame *frames,
+                               uint8_t frameCount, uint16_t timePerFrame, uint16_t timePerTransition)
+    : Widget(x, y, width, height)
+{
+  this->frames = frames;
+  this->frameCount = frameCount;
+  this->timePerFrame = timePerFrame;
+  this->timePerTransition = timePerTransition;
+  this->startTime = millis();
+}
+
+void CarouselWidget::setHardwareScroll(HardwareScroll *scroll)
+{
+  this->scroll = scroll != nullptr && scroll->setScrollArea(y, height) ? scroll : nullptr;
+  scrolled = 0;
+  invalidate();
+}
+
+// The state follows from the time alone: which frame is shown and how far
+// the next one has moved in
+uint32_t CarouselWidget::version()
+{
+  uint32_t cycle = timePerFrame + timePerTransition;
+  uint32_t elapsed = (millis() - startTime) % (cycle * frameCount);
+  uint32_t phase = elapsed % cycle;
+  uint32_t travel = scroll != nullptr ? height : width;
+  frame = elapsed / cycle;
+  offset = phase < timePerFrame ? 0 : travel * (phase - timePerFrame) / timePerTransition;
+  return (uint32_t)frame << 16 | offset;
+}
+
+// Scrolling further into the current transition or finishing it touches no
+// pixels on screen, anything else (skipped steps included) starts over
+boolean CarouselWidget::paintsInPlace()
+{
+  if (scroll == nullptr || !isValid())
+  {
+    return false;
+  }
+  if (frame == shownFrame)
+  {
+    return offset > scrolled;
+  }
+  return frame == (shownFrame + 1) % frameCount && offset == 0 && scrolled > 0;
+}
+
+void CarouselWidget::draw(Canvas *canvas)
+{
+  if (scroll != nullptr)
+  {
+    drawScrolled(canvas);
+    return;
+  }
+  frames[frame](x - offset, y);
+  if (offset > 0)
+  {
+    frames[(frame + 1) % frameCount](x + width - offset, y);
+  }
+}
+
+void CarouselWidget::drawScrolled(Canvas *canvas)
+{
+  if (!paintsInPlace())
+  {
+    // cleared already, shows the frame unscrolled
+    frames[frame](x, y);
+    shownFrame = frame;
+    scrolled = 0;
+    scroll->setScrollOffset(0);
+    return;
+  }
+
+  if (scrolled == 0)
+  {
+    // the rows of the next frame are only sent as they come into view
+    canvas->setRecording(false);
+    clear(canvas);
+    frames[(shownFrame + 1) % frameCount](x, y);
+    canvas->setRecording(true);
+  }
+  uint16_t target = frame == shownFrame ? offset : height;
+  canvas->addDamage(x, y + scrolled, width, target - scrolled);
+  if (target == height)
+  {
+    shownFrame = frame;
+    target = 0;
+  }
+  scrolled = target;
+  scroll->setScrollOffset(scrolled);
+}
+
+FunctionWidget::FunctionWidget(int16_t x, int16_t y, uint16_t width, uint16_t height, DrawCallback callback,
+                               VersionSource version) : Widget(x, y, width, height)
+{
+  this->callback = callback;
+  this->versionSource = version;
+}
+
+uint32_t FunctionWidget::version()
+{
+  return versionSource != nullptr ? versionSource() : 0;
+}
+
+void FunctionWidget::draw(Canvas *canvas)
+{
+  callback();
+}
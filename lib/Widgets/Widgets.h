@@ -0,0 +1,233 @@
+#ifndef _WIDGETS_H_
+#define _WIDGETS_H_
+
+#include <Canvas.h>
+#include <TextBuffer.h>
+#include <HardwareScroll.h>
+
+// Palette index widgets are cleared with before they redraw
+#ifndef WIDGET_BACKGROUND
+#define WIDGET_BACKGROUND 0
+#endif
+
+// Bytes of the stack buffer a label formats its text into
+#ifndef WIDGET_TEXT_SIZE
+#define WIDGET_TEXT_SIZE 48
+#endif
+
+// Returns a value that changes whenever the data shown by a widget changes
+typedef uint32_t (*VersionSource)();
+// Writes the text to show into the buffer
+typedef void (*TextSource)(TextBuffer &text);
+typedef const char *(*BitmapSource)();
+typedef uint8_t (*PercentSource)();
+typedef void (*DrawCallback)();
+typedef void (*CarouselFrame)(int16_t x, int16_t y);
+
+// Retained element of a screen. It knows its bounds and the version of the
+// inputs it was last drawn with and only redraws when that version changes.
+class Widget
+{
+public:
+  Widget(int16_t x, int16_t y, uint16_t width, uint16_t height);
+  virtual ~Widget() {}
+
+  // True if the inputs changed since the last paint
+  boolean isOutdated();
+  // True if the next paint only replaces its own changed pixels, so it needs
+  // no clear and leaves overlapping widgets alone
+  virtual boolean paintsInPlace();
+  boolean overlaps(const Widget *other) const;
+  boolean overlapsRows(int16_t top, uint16_t height) const;
+  void clear(Canvas *canvas);
+  void paint(Canvas *canvas);
+  // Draws the widget completely without changing its state, for bands
+  void repaint(Canvas *canvas);
+  // Forces a redraw on the next update
+  void invalidate();
+
+protected:
+  virtual uint32_t version() = 0;
+  virtual void draw(Canvas *canvas) = 0;
+  // False until the first paint and after invalidate()
+  boolean isValid() const;
+  // Fills with the background even where the transparent color would skip it
+  static void fillBackground(Canvas *canvas, int16_t x, int16_t y, uint16_t width, uint16_t height);
+
+  int16_t x, y;
+  uint16_t width, height;
+
+private:
+  boolean valid = false;
+  uint32_t pendingVersion = 0;
+  uint32_t drawnVersion = 0;
+};
+
+// A set of widgets that are shown together. On a banded canvas update()
+// only marks what changed and the commit draws the bands through the screen.
+class Screen : public BandPainter
+{
+public:
+  Screen(Widget **widgets, uint8_t count);
+
+  // Redraws the outdated widgets, returns false if nothing changed
+  boolean update(Canvas *canvas);
+  void invalidate();
+  void paintBand(Canvas *canvas, int16_t top, uint16_t height);
+
+private:
+  Widget **widgets;
+  uint8_t count;
+};
+
+// Single line of text, anchored according to its alignment within the bounds
+class Label : public Widget
+{
+public:
+  Label(int16_t x, int16_t y, uint16_t width, uint16_t height, const char *font, uint16_t color,
+        TEXT_ALIGNMENT alignment, TextSource text, VersionSource version);
+
+protected:
+  uint32_t version();
+  void draw(Canvas *canvas);
+
+private:
+  const char *font;
+  uint16_t color;
+  TEXT_ALIGNMENT alignment;
+  TextSource text;
+  VersionSource versionSource;
+};
+
+// Single line of ASCII text centered in the bounds, with every digit in a
+// cell as wide as the widest digit. As long as only digits change, the other
+// characters stay where they are and only the cells that changed are
+// cleared and redrawn, e.g. the seconds of a clock.
+class DigitLabel : public Widget
+{
+public:
+  DigitLabel(int16_t x, int16_t y, uint16_t width, uint16_t height, const char *font, uint16_t color,
+             TextSource text, VersionSource version);
+
+  boolean paintsInPlace();
+
+protected:
+  uint32_t version();
+  void draw(Canvas *canvas);
+
+private:
+  uint16_t cellWidth(Canvas *canvas, char c);
+
+  const char *font;
+  uint16_t color;
+  TextSource text;
+  VersionSource versionSource;
+  Text<WIDGET_TEXT_SIZE> pending;
+  Text<WIDGET_TEXT_SIZE> shown;
+  uint16_t digitWidth = 0;
+};
+
+// Fixed label followed by a value at valueOffset
+class ValuePair : public Widget
+{
+public:
+  ValuePair(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t valueOffset, const char *font,
+            uint16_t labelColor, uint16_t valueColor, const char *label, TextSource value, VersionSource version);
+
+protected:
+  uint32_t version();
+  void draw(Canvas *canvas);
+
+private:
+  uint16_t valueOffset;
+  const char *font;
+  uint16_t labelColor, valueColor;
+  const char *label;
+  TextSource value;
+  VersionSource versionSource;
+};
+
+// Paletted bitmap from PROGMEM, drawn at the top left corner of the bounds
+class Icon : public Widget
+{
+public:
+  Icon(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t transparentColor,
+       BitmapSource bitmap, VersionSource version);
+
+protected:
+  uint32_t version();
+  void draw(Canvas *canvas);
+
+private:
+  uint16_t transparentColor;
+  BitmapSource bitmap;
+  VersionSource versionSource;
+};
+
+// Frame with a bar filled to the given percentage
+class ProgressBar : public Widget
+{
+public:
+  ProgressBar(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t frameColor, uint16_t barColor,
+              PercentSource percent);
+
+protected:
+  uint32_t version();
+  void draw(Canvas *canvas);
+
+private:
+  uint16_t frameColor, barColor;
+  PercentSource percent;
+};
+
+// Pages through frames, sliding the next one in from the right. With
+// hardware scrolling the next frame moves up from below instead: it is drawn
+// once when the transition starts and each step only flushes the rows that
+// scroll into view and moves the panel's scroll offset.
+class CarouselWidget : public Widget
+{
+public:
+  CarouselWidget(int16_t x, int16_t y, uint16_t width, uint16_t height, CarouselFrame *frames, uint8_t frameCount,
+                 uint16_t timePerFrame = 5000, uint16_t timePerTransition = 500);
+
+  // Scrolls the bounds with the display, keeps sliding if it cannot.
+  // The widget has to span the whole width of the display.
+  void setHardwareScroll(HardwareScroll *scroll);
+  boolean paintsInPlace();
+
+protected:
+  uint32_t version();
+  void draw(Canvas *canvas);
+
+private:
+  void drawScrolled(Canvas *canvas);
+
+  CarouselFrame *frames;
+  uint8_t frameCount;
+  uint16_t timePerFrame, timePerTransition;
+  uint32_t startTime;
+  uint8_t frame = 0;
+  uint16_t offset = 0;
+  HardwareScroll *scroll = nullptr;
+  // frame on top of the scroll area and the rows it has moved up so far,
+  // while they are above 0 the buffer already holds the next frame
+  uint8_t shownFrame = 0;
+  uint16_t scrolled = 0;
+};
+
+// Anything else, drawn by a callback using absolute coordinates
+class FunctionWidget : public Widget
+{
+public:
+  FunctionWidget(int16_t x, int16_t y, uint16_t width, uint16_t height, DrawCallback callback, VersionSource version);
+
+protected:
+  uint32_t version();
+  void draw(Canvas *canvas);
+
+private:
+  DrawCallback callback;
+  VersionSource versionSource;
+};
+
+#endif
@@ -0,0 +1,118 @@
+#include "WifiCache.h"
+
+#ifdef ESP32
+// kept through resets and deep sleep, lost on power cycles
+RTC_DATA_ATTR static WifiConnection rtcConnection;
+#endif
+#ifdef NATIVE
+static WifiConnection rtcConnection;
+#endif
+
+WifiCache::WifiCache(FS &fs, const char *path) : fs(fs), path(path)
+{
+}
+
+boolean WifiCache::load(const String &ssid, const String &password, WifiConnection *connection)
+{
+  uint32_t network = networkHash(ssid, password);
+  if (readRtc(connection) && connection->network == network)
+  {
+    return true;
+  }
+  File file = fs.open(path, "r");
+  if (!file)
+  {
+    return false;
+  }
+  boolean ok = file.read((uint8_t *)connection, sizeof(WifiConnection)) == sizeof(WifiConnection) &&
+               connection->checksum == checksum(*connection) && connection->network == network;
+  file.close();
+  if (ok)
+  {
+    // the next reset does not have to touch the file system
+    writeRtc(*connection);
+  }
+  return ok;
+}
+
+void WifiCache::save(const String &ssid, const String &password)
+{
+  WifiConnection connection = {};
+  connection.network = networkHash(ssid, password);
+  memcpy(connection.bssid, WiFi.BSSID(), sizeof(connection.bssid));
+  connection.channel = WiFi.channel();
+  connection.ip = WiFi.localIP();
+  connection.gateway = WiFi.gatewayIP();
+  connection.subnet = WiFi.subnetMask();
+  connection.dns = WiFi.dnsIP();
+  connection.checksum = checksum(connection);
+
+  WifiConnection cached;
+  if (load(ssid, password, &cached) && memcmp(&cached, &connection, sizeof(WifiConnection)) == 0)
+  {
+    return;
+  }
+  writeRtc(connection);
+  File file = fs.open(path, "w");
+  if (!file)
+  {
+    Serial.printf("WiFi cache: cannot write %s\n", path);
+    return;
+  }
+  file.write((const uint8_t *)&connection, sizeof(WifiConnection));
+  file.close();
+  Serial.printf("WiFi cache: saved channel %d, %s\n", connection.channel, WiFi.localIP().toString().c_str());
+}
+
+void WifiCache::clear()
+{
+  WifiConnection empty = {};
+  writeRtc(empty);
+  fs.remove(path);
+}
+
+// FNV-1a
+uint32_t WifiCache::hash(const uint8_t *data, size_t size, uint32_t seed)
+{
+  uint32_t value = seed;
+  for (size_t i = 0; i < size; i++)
+  {
+    value = (value ^ data[i]) * 16777619u;
+  }
+  return value;
+}
+
+uint32_t WifiCache::networkHash(const String &ssid, const String &password)
+{
+  // the terminator keeps "ab"/"c" and "a"/"bc" apart
+  return hash((const uint8_t *)password.c_str(), password.length(), hash((const uint8_t *)ssid.c_str(), ssid.length() + 1));
+}
+
+uint32_t WifiCache::checksum(const WifiConnection &connection)
+{
+  const uint8_t *fields = (const uint8_t *)&connection + sizeof(connection.checksum);
+  // never 0, so zeroed memory does not pass
+  return hash(fields, sizeof(WifiConnection) - sizeof(connection.checksum)) | 1;
+}
+
+boolean WifiCache::readRtc(WifiConnection *connection)
+{
+#ifdef ESP8266
+  if (!ESP.rtcUserMemoryRead(WIFI_CACHE_RTC_OFFSET, (uint32_t *)connection, sizeof(WifiConnection)))
+  {
+    return false;
+  }
+#else
+  *connection = rtcConnection;
+#endif
+  return connection->checksum == checksum(*connection);
+}
+
+void WifiCache::writeRtc(const WifiConnection &connection)
+{
+#ifdef ESP8266
+  ESP.rtcUserMemoryWrite(WIFI_CACHE_RTC_OFFSET, (uint32_t *)&connection, sizeof(WifiConnection));
+#else
+  rtcConnection = connection;
+#endif
+}
@@ -0,0 +1,65 @@
+#ifndef _WIFI_CACHE_H_
+#define _WIFI_CACHE_H_
+
+#include <Arduino.h>
+#include <FS.h>
+#if defined(ESP32) || defined(NATIVE)
+#include <WiFi.h>
+#endif
+#ifdef ESP8266
+#include <ESP8266WiFi.h>
+#endif
+
+// How long a reconnect with the cached access point and lease may take
+// before falling back to a scan and DHCP
+#ifndef WIFI_FAST_CONNECT_TIMEOUT
+#define WIFI_FAST_CONNECT_TIMEOUT 2000
+#endif
+
+// Offset in 4 byte blocks into the ESP8266 RTC user memory, the first 128
+// bytes belong to the OTA updater
+#ifndef WIFI_CACHE_RTC_OFFSET
+#define WIFI_CACHE_RTC_OFFSET 32
+#endif
+
+// What a reconnect needs to skip the scan and DHCP
+struct WifiConnection
+{
+  // over all following fields, tells uninitialized RTC memory apart
+  uint32_t checksum;
+  // hash of SSID and password the connection was made with
+  uint32_t network;
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint8_t reserved;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+};
+
+// Remembers access point and DHCP lease of the last connection. RTC memory
+// survives resets and deep sleep, the copy on flash power cycles.
+class WifiCache
+{
+public:
+  WifiCache(FS &fs, const char *path = "/wifi.bin");
+
+  // False if nothing was cached for this network
+  boolean load(const String &ssid, const String &password, WifiConnection *connection);
+  // Takes the current connection, flash is only written when it changed
+  void save(const String &ssid, const String &password);
+  void clear();
+
+private:
+  static uint32_t hash(const uint8_t *data, size_t size, uint32_t seed = 2166136261u);
+  static uint32_t networkHash(const String &ssid, const String &password);
+  static uint32_t checksum(const WifiConnection &connection);
+  boolean readRtc(WifiConnection *connection);
+  void writeRtc(const WifiConnection &connection);
+
+  FS &fs;
+  const char *path;
+};
+
+#endif
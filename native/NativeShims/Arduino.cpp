@@ -0,0 +1,137 @@
+#include "Arduino.h"
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+// time skipped by delay() instead of sleeping
+static uint64_t skippedMicros = 0;
+static uint8_t pinLevels[256];
+static bool clockFrozen = false;
+static time_t frozenEpoch = 0;
+
+unsigned long micros()
+{
+  if (clockFrozen)
+  {
+    return skippedMicros;
+  }
+  auto elapsed = std::chrono::steady_clock::now() - bootTime;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + skippedMicros;
+}
+
+void nativeFreezeClock(time_t epoch)
+{
+  clockFrozen = true;
+  frozenEpoch = epoch;
+  skippedMicros = 0;
+}
+
+// replaces the C library's time() so the clock widgets can be frozen too
+extern "C" time_t time(time_t *result)
+{
+  time_t now;
+  if (clockFrozen)
+  {
+    now = frozenEpoch + skippedMicros / 1000000;
+  }
+  else
+  {
+    now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+  }
+  if (result != nullptr)
+  {
+    *result = now;
+  }
+  return now;
+}
+
+unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+void delay(unsigned long ms)
+{
+  skippedMicros += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  skippedMicros += us;
+}
+
+void yield()
+{
+}
+
+long random(long max)
+{
+  return max > 0 ? rand() % max : 0;
+}
+
+long random(long min, long max)
+{
+  return min + random(max - min);
+}
+
+#ifdef NATIVE_STRLCPY
+size_t strlcpy(char *destination, const char *source, size_t size)
+{
+  size_t length = strlen(source);
+  if (size > 0)
+  {
+    size_t copied = min(length, size - 1);
+    memcpy(destination, source, copied);
+    destination[copied] = '\0';
+  }
+  return length;
+}
+#endif
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  pinLevels[pin] = value ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pinLevels[pin];
+}
+
+void HardwareSerial::begin(unsigned long baud)
+{
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  fputc(c, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  return fwrite(buffer, 1, size, stdout);
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+  return 0;
+}
+
+uint8_t EspClass::getCpuFreqMHz()
+{
+  return 0;
+}
+
+void EspClass::restart()
+{
+  exit(0);
+}
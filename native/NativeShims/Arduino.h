@@ -0,0 +1,103 @@
+#ifndef _NATIVE_ARDUINO_H_
+#define _NATIVE_ARDUINO_H_
+
+// Just enough of the Arduino core to build the weather station on the host.
+// Time is partly virtual: delay() advances millis() without sleeping, so
+// paced loops run as fast as the host can render them.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+
+#include "pgmspace.h"
+#include "WString.h"
+#include "Print.h"
+
+// normally passed by the build, headers test it before including Arduino.h
+#ifndef ARDUINO
+#define ARDUINO 10800
+#endif
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+using std::max;
+using std::min;
+
+// attributes that place code or data on the ESPs
+#define ICACHE_FLASH_ATTR
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define _BV(bit) (1 << (bit))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+long random(long max);
+long random(long min, long max);
+
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 38)
+// both cores have it, glibc only since 2.38
+#define NATIVE_STRLCPY
+size_t strlcpy(char *destination, const char *source, size_t size);
+#endif
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+// Serial prints to stdout
+class HardwareSerial : public Print
+{
+public:
+  void begin(unsigned long baud);
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
+  void flush() { fflush(stdout); }
+};
+extern HardwareSerial Serial;
+
+class EspClass
+{
+public:
+  uint32_t getFreeHeap();
+  uint8_t getCpuFreqMHz();
+  void restart();
+};
+extern EspClass ESP;
+
+// Host only: stops real time from leaking into millis() and time(), both
+// then start at the given epoch and only move with delay()
+void nativeFreezeClock(time_t epoch);
+// Host only: number of allocations and bytes requested so far, operator
+// new always and with glibc malloc() as well
+uint32_t nativeAllocations();
+uint64_t nativeAllocatedBytes();
+
+void setup();
+void loop();
+
+#endif
@@ -0,0 +1,26 @@
+#include "Astronomy.h"
+
+static const double SYNODIC_MONTH = 29.530588853;
+// new moon of 2000-01-06 18:14 UTC
+static const double KNOWN_NEW_MOON = 947182440;
+
+double Astronomy::moonAge(time_t timestamp)
+{
+  double days = (timestamp - KNOWN_NEW_MOON) / 86400.0;
+  double age = fmod(days, SYNODIC_MONTH);
+  return age < 0 ? age + SYNODIC_MONTH : age;
+}
+
+Astronomy::MoonData Astronomy::calculateMoonData(time_t timestamp)
+{
+  MoonData data;
+  double age = moonAge(timestamp);
+  data.phase = calculateMoonPhase(timestamp);
+  data.illumination = (1 - cos(2 * PI * age / SYNODIC_MONTH)) / 2;
+  return data;
+}
+
+uint8_t Astronomy::calculateMoonPhase(time_t timestamp)
+{
+  return (uint8_t)(moonAge(timestamp) / SYNODIC_MONTH * 8 + 0.5) & 7;
+}
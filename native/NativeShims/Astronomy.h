@@ -0,0 +1,23 @@
+#ifndef _NATIVE_ASTRONOMY_H_
+#define _NATIVE_ASTRONOMY_H_
+
+#include "Arduino.h"
+
+// Same interface as the ThingPulse class, based on the mean synodic month
+class Astronomy
+{
+public:
+  typedef struct MoonData
+  {
+    uint8_t phase;
+    double illumination;
+  } MoonData;
+
+  MoonData calculateMoonData(time_t timestamp);
+  uint8_t calculateMoonPhase(time_t timestamp);
+
+private:
+  double moonAge(time_t timestamp);
+};
+
+#endif
@@ -0,0 +1,175 @@
+#include "FS.h"
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FS SPIFFS("NATIVE_FS");
+FS LittleFS("NATIVE_FS");
+
+File::File(FILE *file) : file(file) {}
+
+File::File(File &&other) : file(other.file)
+{
+  other.file = nullptr;
+}
+
+File &File::operator=(File &&other)
+{
+  close();
+  file = other.file;
+  other.file = nullptr;
+  return *this;
+}
+
+File::~File()
+{
+  close();
+}
+
+int File::available()
+{
+  if (file == nullptr)
+  {
+    return 0;
+  }
+  long current = ftell(file);
+  fseek(file, 0, SEEK_END);
+  long end = ftell(file);
+  fseek(file, current, SEEK_SET);
+  return end - current;
+}
+
+int File::read()
+{
+  return file != nullptr ? fgetc(file) : -1;
+}
+
+size_t File::read(uint8_t *buffer, size_t size)
+{
+  return file != nullptr ? fread(buffer, 1, size, file) : 0;
+}
+
+int File::peek()
+{
+  int c = read();
+  if (c >= 0)
+  {
+    ungetc(c, file);
+  }
+  return c;
+}
+
+String File::readStringUntil(char terminator)
+{
+  String result;
+  int c;
+  while ((c = read()) >= 0 && c != terminator)
+  {
+    result += (char)c;
+  }
+  return result;
+}
+
+String File::readString()
+{
+  String result;
+  int c;
+  while ((c = read()) >= 0)
+  {
+    result += (char)c;
+  }
+  return result;
+}
+
+size_t File::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t File::write(const uint8_t *buffer, size_t size)
+{
+  return file != nullptr ? fwrite(buffer, 1, size, file) : 0;
+}
+
+bool File::seek(uint32_t position)
+{
+  return file != nullptr && fseek(file, position, SEEK_SET) == 0;
+}
+
+size_t File::position()
+{
+  return file != nullptr ? ftell(file) : 0;
+}
+
+size_t File::size()
+{
+  return position() + available();
+}
+
+void File::flush()
+{
+  if (file != nullptr)
+  {
+    fflush(file);
+  }
+}
+
+void File::close()
+{
+  if (file != nullptr)
+  {
+    fclose(file);
+    file = nullptr;
+  }
+}
+
+FS::FS(const char *environmentVariable) : environmentVariable(environmentVariable) {}
+
+bool FS::begin(bool formatOnFail)
+{
+  const char *configured = getenv(environmentVariable);
+  root = configured != nullptr ? configured : "native_fs";
+  mkdir(root.c_str(), 0755);
+  struct stat info;
+  return stat(root.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+bool FS::format()
+{
+  // deliberately keeps the host files, only flat layouts are used anyway
+  return begin();
+}
+
+std::string FS::hostPath(const char *path)
+{
+  if (root.empty())
+  {
+    begin();
+  }
+  return root + (path[0] == '/' ? "" : "/") + path;
+}
+
+File FS::open(const char *path, const char *mode)
+{
+  std::string hostMode = mode;
+  if (hostMode.find('b') == std::string::npos)
+  {
+    hostMode += 'b';
+  }
+  return File(fopen(hostPath(path).c_str(), hostMode.c_str()));
+}
+
+bool FS::exists(const char *path)
+{
+  return access(hostPath(path).c_str(), F_OK) == 0;
+}
+
+bool FS::remove(const char *path)
+{
+  return unlink(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char *from, const char *to)
+{
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
@@ -0,0 +1,63 @@
+#ifndef _NATIVE_FS_H_
+#define _NATIVE_FS_H_
+
+#include "Arduino.h"
+#include <stdio.h>
+#include <string>
+
+// File backed by a host file below the directory of the FS
+class File : public Print
+{
+public:
+  File(FILE *file = nullptr);
+  File(const File &) = delete;
+  File(File &&other);
+  File &operator=(File &&other);
+  ~File();
+
+  operator bool() const { return file != nullptr; }
+  int available();
+  int read();
+  size_t read(uint8_t *buffer, size_t size);
+  int peek();
+  String readStringUntil(char terminator);
+  String readString();
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
+  bool seek(uint32_t position);
+  size_t position();
+  size_t size();
+  void flush();
+  void close();
+
+private:
+  FILE *file;
+};
+
+class FS
+{
+public:
+  FS(const char *environmentVariable);
+
+  bool begin(bool formatOnFail = false);
+  void end() {}
+  bool format();
+  File open(const char *path, const char *mode = "r");
+  File open(const String &path, const char *mode = "r") { return open(path.c_str(), mode); }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool rename(const char *from, const char *to);
+
+private:
+  std::string hostPath(const char *path);
+  const char *environmentVariable;
+  std::string root;
+};
+
+// Both live in $NATIVE_FS, "native_fs" by default
+extern FS SPIFFS;
+extern FS LittleFS;
+
+#endif
@@ -0,0 +1,95 @@
+#include "Arduino.h"
+#include <new>
+
+// Counts every allocation made through operator new, String included. With
+// glibc malloc() itself is replaced, which also catches the copies MiniGrafx
+// makes of every string it draws.
+static uint32_t allocations = 0;
+static uint64_t allocatedBytes = 0;
+
+static void countAllocation(size_t size)
+{
+  allocations++;
+  allocatedBytes += size;
+}
+
+#ifdef __GLIBC__
+extern "C"
+{
+  void *__libc_malloc(size_t size);
+  void *__libc_calloc(size_t count, size_t size);
+  void *__libc_realloc(void *memory, size_t size);
+  void __libc_free(void *memory);
+
+  void *malloc(size_t size)
+  {
+    countAllocation(size);
+    return __libc_malloc(size);
+  }
+
+  void *calloc(size_t count, size_t size)
+  {
+    countAllocation(count * size);
+    return __libc_calloc(count, size);
+  }
+
+  void *realloc(void *memory, size_t size)
+  {
+    countAllocation(size);
+    return __libc_realloc(memory, size);
+  }
+
+  void free(void *memory)
+  {
+    __libc_free(memory);
+  }
+}
+#endif
+
+uint32_t nativeAllocations()
+{
+  return allocations;
+}
+
+uint64_t nativeAllocatedBytes()
+{
+  return allocatedBytes;
+}
+
+void *operator new(size_t size)
+{
+#ifndef __GLIBC__
+  countAllocation(size);
+#endif
+  void *memory = malloc(size > 0 ? size : 1);
+  if (memory == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete(void *memory, size_t size) noexcept
+{
+  free(memory);
+}
+
+void operator delete[](void *memory, size_t size) noexcept
+{
+  free(memory);
+}
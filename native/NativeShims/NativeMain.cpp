@@ -0,0 +1,77 @@
+#include "Arduino.h"
+#include "NativePanel.h"
+#include <chrono>
+#include <stdio.h>
+
+#ifndef ST7789_TFTWIDTH
+#define ST7789_TFTWIDTH 240
+#endif
+#ifndef ST7789_TFTHEIGHT
+#define ST7789_TFTHEIGHT 320
+#endif
+
+// Provided by the application if it has a render suite, see src/NativeSuite.cpp
+int runSuite(NativePanel *panel, int argc, char **argv) __attribute__((weak));
+
+// Runs setup() and a number of loop() iterations against the emulated panel
+// and reports the render time and the SPI traffic per frame.
+//
+//   program [--frames N] [--capture file.ppm]
+//   program --suite ...   hands over to runSuite()
+int main(int argc, char **argv)
+{
+  NativePanel panel(ST7789_TFTWIDTH, ST7789_TFTHEIGHT, TFT_DC);
+  SPI.setListener(&panel);
+  if (argc > 1 && strcmp(argv[1], "--suite") == 0 && runSuite != nullptr)
+  {
+    return runSuite(&panel, argc - 1, argv + 1);
+  }
+
+  unsigned long frames = 300;
+  const char *capture = nullptr;
+  for (int i = 1; i < argc - 1; i++)
+  {
+    if (strcmp(argv[i], "--frames") == 0)
+    {
+      frames = strtoul(argv[++i], nullptr, 10);
+    }
+    else if (strcmp(argv[i], "--capture") == 0)
+    {
+      capture = argv[++i];
+    }
+  }
+
+  setup();
+
+  SPI.resetCounters();
+  panel.resetCounters();
+  uint64_t totalMicros = 0;
+  uint64_t worstMicros = 0;
+  for (unsigned long frame = 0; frame < frames; frame++)
+  {
+    // measured in real time, delay() only moves the virtual clock
+    auto start = std::chrono::steady_clock::now();
+    loop();
+    uint64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    totalMicros += elapsed;
+    worstMicros = max(worstMicros, elapsed);
+  }
+
+  if (frames > 0)
+  {
+    // at the clock the driver asked for
+    double busMicros = SPI.getBytes() * 8 * 1e6 / SPI.getFrequency();
+    printf("frames:            %lu\n", frames);
+    printf("loop avg / max:    %llu / %llu us\n", (unsigned long long)(totalMicros / frames), (unsigned long long)worstMicros);
+    printf("bus bytes / frame: %llu\n", (unsigned long long)(SPI.getBytes() / frames));
+    printf("bus time / frame:  %.0f us at %u Hz\n", busMicros / frames, SPI.getFrequency());
+    printf("windows / frame:   %.2f\n", (double)panel.getWindows() / frames);
+    printf("pixels / frame:    %u\n", (unsigned)(panel.getPixelsWritten() / frames));
+  }
+  if (capture != nullptr && !panel.savePpm(capture))
+  {
+    fprintf(stderr, "could not write %s\n", capture);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,221 @@
+#include "NativePanel.h"
+#include <stdio.h>
+
+#define PANEL_CASET 0x2A
+#define PANEL_RASET 0x2B
+#define PANEL_RAMWR 0x2C
+#define PANEL_VSCRDEF 0x33
+#define PANEL_MADCTL 0x36
+#define PANEL_VSCRSADD 0x37
+#define PANEL_MADCTL_MY 0x80
+#define PANEL_MADCTL_MV 0x20
+
+NativePanel::NativePanel(uint16_t width, uint16_t height, uint8_t dcPin)
+    : width(width), height(height), dcPin(dcPin), scrollHeight(height)
+{
+  pixels = new uint16_t[(uint32_t)width * height]();
+}
+
+NativePanel::~NativePanel()
+{
+  delete[] pixels;
+}
+
+uint16_t NativePanel::getWidth() const
+{
+  return madctl & PANEL_MADCTL_MV ? height : width;
+}
+
+uint16_t NativePanel::getHeight() const
+{
+  return madctl & PANEL_MADCTL_MV ? width : height;
+}
+
+uint16_t NativePanel::getPixel(uint16_t x, uint16_t y) const
+{
+  if (x >= getWidth() || y >= getHeight())
+  {
+    return 0;
+  }
+  // memory lines run along y unless rows and columns are exchanged
+  if (!(madctl & PANEL_MADCTL_MV) && scrollHeight > 0)
+  {
+    uint16_t line = madctl & PANEL_MADCTL_MY ? height - 1 - y : y;
+    if (line >= scrollTop && line < scrollTop + scrollHeight)
+    {
+      uint16_t start = (scrollStart + scrollHeight - scrollTop % scrollHeight) % scrollHeight;
+      line = scrollTop + (line - scrollTop + start) % scrollHeight;
+      y = madctl & PANEL_MADCTL_MY ? height - 1 - line : line;
+    }
+  }
+  return pixels[(uint32_t)y * getWidth() + x];
+}
+
+void NativePanel::resetCounters()
+{
+  windows = 0;
+  pixelsWritten = 0;
+}
+
+void NativePanel::onSpiByte(uint8_t value)
+{
+  if (digitalRead(dcPin) == LOW)
+  {
+    command(value);
+  }
+  else
+  {
+    data(value);
+  }
+}
+
+void NativePanel::command(uint8_t command)
+{
+  currentCommand = command;
+  parameterCount = 0;
+  if (command == PANEL_RAMWR)
+  {
+    column = columnStart;
+    row = rowStart;
+    highByte = true;
+    windows++;
+  }
+}
+
+void NativePanel::data(uint8_t value)
+{
+  switch (currentCommand)
+  {
+  case PANEL_CASET:
+  case PANEL_RASET:
+    if (parameterCount < 4)
+    {
+      parameters[parameterCount++] = value;
+    }
+    if (parameterCount == 4)
+    {
+      uint16_t start = parameters[0] << 8 | parameters[1];
+      uint16_t end = parameters[2] << 8 | parameters[3];
+      if (currentCommand == PANEL_CASET)
+      {
+        columnStart = start;
+        columnEnd = end;
+      }
+      else
+      {
+        rowStart = start;
+        rowEnd = end;
+      }
+    }
+    break;
+  case PANEL_MADCTL:
+    madctl = value;
+    break;
+  case PANEL_VSCRDEF:
+  case PANEL_VSCRSADD:
+    if (parameterCount < 6)
+    {
+      parameters[parameterCount++] = value;
+    }
+    if (currentCommand == PANEL_VSCRSADD && parameterCount == 2)
+    {
+      scrollStart = parameters[0] << 8 | parameters[1];
+    }
+    else if (currentCommand == PANEL_VSCRDEF && parameterCount == 6)
+    {
+      scrollTop = parameters[0] << 8 | parameters[1];
+      scrollHeight = parameters[2] << 8 | parameters[3];
+    }
+    break;
+  case PANEL_RAMWR:
+    if (highByte)
+    {
+      pixel = value << 8;
+      highByte = false;
+      break;
+    }
+    pixel |= value;
+    highByte = true;
+    if (column < getWidth() && row < getHeight())
+    {
+      pixels[(uint32_t)row * getWidth() + column] = pixel;
+    }
+    pixelsWritten++;
+    // the address counter wraps inside the window like the controller's
+    if (++column > columnEnd)
+    {
+      column = columnStart;
+      if (++row > rowEnd)
+      {
+        row = rowStart;
+      }
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+bool NativePanel::savePpm(const char *path) const
+{
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr)
+  {
+    return false;
+  }
+  fprintf(file, "P6\n%d %d\n255\n", getWidth(), getHeight());
+  for (uint16_t y = 0; y < getHeight(); y++)
+  {
+    for (uint16_t x = 0; x < getWidth(); x++)
+    {
+      uint8_t rgb[3];
+      toRgb(getPixel(x, y), rgb);
+      fwrite(rgb, 1, 3, file);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+int32_t NativePanel::comparePpm(const char *path) const
+{
+  FILE *file = fopen(path, "rb");
+  if (file == nullptr)
+  {
+    return -1;
+  }
+  int width, height, depth;
+  if (fscanf(file, "P6 %d %d %d", &width, &height, &depth) != 3 || fgetc(file) < 0 ||
+      width != getWidth() || height != getHeight())
+  {
+    fclose(file);
+    return -1;
+  }
+  int32_t mismatches = 0;
+  for (uint16_t y = 0; y < getHeight(); y++)
+  {
+    for (uint16_t x = 0; x < getWidth(); x++)
+    {
+      uint8_t expected[3], actual[3];
+      if (fread(expected, 1, 3, file) != 3)
+      {
+        fclose(file);
+        return -1;
+      }
+      toRgb(getPixel(x, y), actual);
+      if (memcmp(expected, actual, 3) != 0)
+      {
+        mismatches++;
+      }
+    }
+  }
+  fclose(file);
+  return mismatches;
+}
+
+void NativePanel::toRgb(uint16_t color, uint8_t *rgb) const
+{
+  rgb[0] = (color >> 11) * 255 / 31;
+  rgb[1] = ((color >> 5) & 0x3F) * 255 / 63;
+  rgb[2] = (color & 0x1F) * 255 / 31;
+}
@@ -0,0 +1,53 @@
+#ifndef _NATIVE_PANEL_H_
+#define _NATIVE_PANEL_H_
+
+#include "SPI.h"
+
+// Emulates the RAM side of an ST7789 behind the SPI shim: interprets
+// CASET/RASET/RAMWR/MADCTL and captures the pixels in display orientation.
+// VSCRDEF/VSCRSADD are applied when reading pixels back, so getPixel()
+// returns what the panel shows.
+class NativePanel : public SPIListener
+{
+public:
+  NativePanel(uint16_t width, uint16_t height, uint8_t dcPin);
+  ~NativePanel();
+
+  void onSpiByte(uint8_t data);
+
+  // Logical size, width and height swap when MADCTL exchanges rows and columns
+  uint16_t getWidth() const;
+  uint16_t getHeight() const;
+  uint16_t getPixel(uint16_t x, uint16_t y) const;
+  uint32_t getWindows() const { return windows; }
+  uint32_t getPixelsWritten() const { return pixelsWritten; }
+  void resetCounters();
+  // Stores the captured image as binary PPM
+  bool savePpm(const char *path) const;
+  // Number of pixels differing from a PPM written by savePpm(), -1 if the
+  // file is missing or has another size
+  int32_t comparePpm(const char *path) const;
+
+private:
+  void toRgb(uint16_t color, uint8_t *rgb) const;
+  void command(uint8_t command);
+  void data(uint8_t data);
+
+  uint16_t width, height;
+  uint8_t dcPin;
+  uint16_t *pixels;
+  uint8_t madctl = 0;
+  uint8_t currentCommand = 0;
+  uint8_t parameters[6];
+  uint8_t parameterCount = 0;
+  uint16_t columnStart = 0, columnEnd = 0, rowStart = 0, rowEnd = 0;
+  uint16_t column = 0, row = 0;
+  // vertical scrolling in memory lines, defaults to the whole panel
+  uint16_t scrollTop = 0, scrollHeight, scrollStart = 0;
+  bool highByte = true;
+  uint16_t pixel = 0;
+  uint32_t windows = 0;
+  uint32_t pixelsWritten = 0;
+};
+
+#endif
@@ -0,0 +1,88 @@
+#include "Print.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+  {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::write(const char *text)
+{
+  return text != nullptr ? write((const uint8_t *)text, strlen(text)) : 0;
+}
+
+size_t Print::print(const String &text)
+{
+  return write((const uint8_t *)text.c_str(), text.length());
+}
+
+size_t Print::print(const char *text)
+{
+  return write(text);
+}
+
+size_t Print::print(char c)
+{
+  return write((uint8_t)c);
+}
+
+size_t Print::print(int value, int base)
+{
+  return print(String(value, base));
+}
+
+size_t Print::print(unsigned int value, int base)
+{
+  return print(String(value, base));
+}
+
+size_t Print::print(long value, int base)
+{
+  return print(String(value, base));
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+  return print(String(value, base));
+}
+
+size_t Print::print(double value, int decimals)
+{
+  return print(String(value, decimals));
+}
+
+size_t Print::println()
+{
+  return write("\r\n");
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0)
+  {
+    return 0;
+  }
+  if ((size_t)length < sizeof(buffer))
+  {
+    return write((const uint8_t *)buffer, length);
+  }
+  char *large = new char[length + 1];
+  va_start(args, format);
+  vsnprintf(large, length + 1, format, args);
+  va_end(args);
+  size_t n = write((const uint8_t *)large, length);
+  delete[] large;
+  return n;
+}
@@ -0,0 +1,84 @@
+#include "SPI.h"
+
+SPIClass SPI;
+
+void SPIClass::begin()
+{
+}
+
+void SPIClass::end()
+{
+}
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+  frequency = settings.clock;
+  transactions++;
+}
+
+void SPIClass::endTransaction()
+{
+}
+
+void SPIClass::setFrequency(uint32_t frequency)
+{
+  this->frequency = frequency;
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  write(data);
+  return 0;
+}
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+  write16(data);
+  return 0;
+}
+
+void SPIClass::write(uint8_t data)
+{
+  bytes++;
+  if (listener != nullptr)
+  {
+    listener->onSpiByte(data);
+  }
+}
+
+void SPIClass::write16(uint16_t data)
+{
+  write(data >> 8);
+  write(data);
+}
+
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size)
+{
+  while (size--)
+  {
+    write(*data++);
+  }
+}
+
+void SPIClass::transferBytes(const uint8_t *data, uint8_t *out, uint32_t size)
+{
+  for (uint32_t i = 0; i < size; i++)
+  {
+    write(data != nullptr ? data[i] : 0xFF);
+    if (out != nullptr)
+    {
+      out[i] = 0;
+    }
+  }
+}
+
+void SPIClass::setListener(SPIListener *listener)
+{
+  this->listener = listener;
+}
+
+void SPIClass::resetCounters()
+{
+  bytes = 0;
+  transactions = 0;
+}
@@ -0,0 +1,59 @@
+#ifndef _NATIVE_SPI_H_
+#define _NATIVE_SPI_H_
+
+#include "Arduino.h"
+
+#define SPI_HAS_TRANSACTION
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+class SPISettings
+{
+public:
+  SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) : clock(clock) {}
+  uint32_t clock;
+};
+
+// Receives every byte clocked out, see NativePanel
+class SPIListener
+{
+public:
+  virtual ~SPIListener() {}
+  virtual void onSpiByte(uint8_t data) = 0;
+};
+
+// Hardware SPI that counts the traffic and hands it to a listener
+class SPIClass
+{
+public:
+  void begin();
+  void end();
+  void beginTransaction(SPISettings settings);
+  void endTransaction();
+  void setFrequency(uint32_t frequency);
+
+  uint8_t transfer(uint8_t data);
+  uint16_t transfer16(uint16_t data);
+  void write(uint8_t data);
+  void write16(uint16_t data);
+  void writeBytes(const uint8_t *data, uint32_t size);
+  void transferBytes(const uint8_t *data, uint8_t *out, uint32_t size);
+
+  void setListener(SPIListener *listener);
+  uint64_t getBytes() const { return bytes; }
+  uint32_t getTransactions() const { return transactions; }
+  uint32_t getFrequency() const { return frequency; }
+  void resetCounters();
+
+private:
+  SPIListener *listener = nullptr;
+  uint64_t bytes = 0;
+  uint32_t transactions = 0;
+  uint32_t frequency = 40000000;
+};
+
+extern SPIClass SPI;
+
+#endif
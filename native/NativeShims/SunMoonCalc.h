@@ -0,0 +1 @@
+// Only referenced from commented out code, nothing to provide on the host
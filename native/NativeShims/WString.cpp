@@ -0,0 +1,285 @@
+#include "WString.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+static std::string formatInteger(unsigned long value, bool negative, unsigned char base)
+{
+  if (base < 2 || base > 36)
+  {
+    base = 10;
+  }
+  char digits[66];
+  int pos = sizeof(digits) - 1;
+  digits[pos] = 0;
+  do
+  {
+    uint8_t digit = value % base;
+    digits[--pos] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+    value /= base;
+  } while (value > 0);
+  if (negative)
+  {
+    digits[--pos] = '-';
+  }
+  return std::string(digits + pos);
+}
+
+static std::string formatSigned(long value, unsigned char base)
+{
+  if (base == 10 && value < 0)
+  {
+    return formatInteger(-(unsigned long)value, true, base);
+  }
+  return formatInteger(value, false, base);
+}
+
+static std::string formatFloat(double value, unsigned char decimals)
+{
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+  return buffer;
+}
+
+String::String(const char *value) : value(value != nullptr ? value : "") {}
+String::String(const std::string &value) : value(value) {}
+String::String(const __FlashStringHelper *value) : value(value != nullptr ? (const char *)value : "") {}
+String::String(char c) : value(1, c) {}
+String::String(unsigned char value, unsigned char base) : value(formatInteger(value, false, base)) {}
+String::String(int value, unsigned char base) : value(formatSigned(value, base)) {}
+String::String(unsigned int value, unsigned char base) : value(formatInteger(value, false, base)) {}
+String::String(long value, unsigned char base) : value(formatSigned(value, base)) {}
+String::String(unsigned long value, unsigned char base) : value(formatInteger(value, false, base)) {}
+String::String(float value, unsigned char decimals) : value(formatFloat(value, decimals)) {}
+String::String(double value, unsigned char decimals) : value(formatFloat(value, decimals)) {}
+
+bool String::reserve(unsigned int size)
+{
+  value.reserve(size);
+  return true;
+}
+
+char String::charAt(unsigned int index) const
+{
+  return index < value.length() ? value[index] : 0;
+}
+
+void String::setCharAt(unsigned int index, char c)
+{
+  if (index < value.length())
+  {
+    value[index] = c;
+  }
+}
+
+char &String::operator[](unsigned int index)
+{
+  static char dummy;
+  if (index >= value.length())
+  {
+    dummy = 0;
+    return dummy;
+  }
+  return value[index];
+}
+
+String &String::operator+=(const String &other)
+{
+  value += other.value;
+  return *this;
+}
+
+String &String::operator+=(const char *other)
+{
+  if (other != nullptr)
+  {
+    value += other;
+  }
+  return *this;
+}
+
+String &String::operator+=(char c)
+{
+  value += c;
+  return *this;
+}
+
+bool String::concat(const String &other)
+{
+  value += other.value;
+  return true;
+}
+
+bool String::equalsIgnoreCase(const String &other) const
+{
+  if (value.length() != other.value.length())
+  {
+    return false;
+  }
+  for (size_t i = 0; i < value.length(); i++)
+  {
+    if (tolower((unsigned char)value[i]) != tolower((unsigned char)other.value[i]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool String::startsWith(const String &prefix) const
+{
+  return value.compare(0, prefix.value.length(), prefix.value) == 0;
+}
+
+bool String::endsWith(const String &suffix) const
+{
+  return value.length() >= suffix.value.length() &&
+         value.compare(value.length() - suffix.value.length(), suffix.value.length(), suffix.value) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+  size_t pos = value.find(c, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String &text, unsigned int from) const
+{
+  size_t pos = value.find(text.value, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const
+{
+  size_t pos = value.rfind(c);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from) const
+{
+  return substring(from, value.length());
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+  if (from > to)
+  {
+    std::swap(from, to);
+  }
+  if (from >= value.length())
+  {
+    return String();
+  }
+  return String(value.substr(from, std::min((size_t)to, value.length()) - from));
+}
+
+void String::replace(const String &find, const String &replacement)
+{
+  if (find.value.empty())
+  {
+    return;
+  }
+  size_t pos = 0;
+  while ((pos = value.find(find.value, pos)) != std::string::npos)
+  {
+    value.replace(pos, find.value.length(), replacement.value);
+    pos += replacement.value.length();
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+  if (index < value.length())
+  {
+    value.erase(index, count);
+  }
+}
+
+void String::trim()
+{
+  size_t begin = value.find_first_not_of(" \t\r\n");
+  if (begin == std::string::npos)
+  {
+    value.clear();
+    return;
+  }
+  size_t end = value.find_last_not_of(" \t\r\n");
+  value = value.substr(begin, end - begin + 1);
+}
+
+void String::toLowerCase()
+{
+  for (char &c : value)
+  {
+    c = tolower((unsigned char)c);
+  }
+}
+
+void String::toUpperCase()
+{
+  for (char &c : value)
+  {
+    c = toupper((unsigned char)c);
+  }
+}
+
+long String::toInt() const
+{
+  return atol(value.c_str());
+}
+
+float String::toFloat() const
+{
+  return atof(value.c_str());
+}
+
+double String::toDouble() const
+{
+  return atof(value.c_str());
+}
+
+void String::toCharArray(char *buffer, unsigned int size, unsigned int index) const
+{
+  getBytes((unsigned char *)buffer, size, index);
+}
+
+void String::getBytes(unsigned char *buffer, unsigned int size, unsigned int index) const
+{
+  if (size == 0)
+  {
+    return;
+  }
+  size_t count = index < value.length() ? std::min((size_t)size - 1, value.length() - index) : 0;
+  memcpy(buffer, value.c_str() + index, count);
+  buffer[count] = 0;
+}
+
+String operator+(const String &a, const String &b)
+{
+  String result(a);
+  result += b;
+  return result;
+}
+
+String operator+(const String &a, const char *b)
+{
+  String result(a);
+  result += b;
+  return result;
+}
+
+String operator+(const char *a, const String &b)
+{
+  String result(a);
+  result += b;
+  return result;
+}
+
+String operator+(const String &a, char b)
+{
+  String result(a);
+  result += b;
+  return result;
+}
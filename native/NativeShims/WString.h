@@ -0,0 +1,82 @@
+#ifndef _NATIVE_WSTRING_H_
+#define _NATIVE_WSTRING_H_
+
+#include <stdint.h>
+#include <string>
+
+class __FlashStringHelper;
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper *>(p))
+#define F(s) FPSTR(s)
+
+// Arduino String on top of std::string
+class String
+{
+public:
+  String(const char *value = "");
+  String(const std::string &value);
+  String(const __FlashStringHelper *value);
+  explicit String(char c);
+  explicit String(unsigned char value, unsigned char base = 10);
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(float value, unsigned char decimals = 2);
+  explicit String(double value, unsigned char decimals = 2);
+
+  const char *c_str() const { return value.c_str(); }
+  unsigned int length() const { return value.length(); }
+  bool reserve(unsigned int size);
+
+  char charAt(unsigned int index) const;
+  void setCharAt(unsigned int index, char c);
+  char operator[](unsigned int index) const { return charAt(index); }
+  char &operator[](unsigned int index);
+
+  String &operator+=(const String &other);
+  String &operator+=(const char *other);
+  String &operator+=(char c);
+  template <typename T>
+  String &operator+=(T other) { return *this += String(other); }
+  bool concat(const String &other);
+
+  bool equals(const String &other) const { return value == other.value; }
+  bool equalsIgnoreCase(const String &other) const;
+  bool operator==(const String &other) const { return value == other.value; }
+  bool operator==(const char *other) const { return value == other; }
+  bool operator!=(const String &other) const { return value != other.value; }
+  bool operator!=(const char *other) const { return value != other; }
+  bool operator<(const String &other) const { return value < other.value; }
+  int compareTo(const String &other) const { return value.compare(other.value); }
+  bool startsWith(const String &prefix) const;
+  bool endsWith(const String &suffix) const;
+
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const String &text, unsigned int from = 0) const;
+  int lastIndexOf(char c) const;
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+  void replace(const String &find, const String &replacement);
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1);
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+
+  long toInt() const;
+  float toFloat() const;
+  double toDouble() const;
+  void toCharArray(char *buffer, unsigned int size, unsigned int index = 0) const;
+  void getBytes(unsigned char *buffer, unsigned int size, unsigned int index = 0) const;
+
+private:
+  std::string value;
+};
+
+String operator+(const String &a, const String &b);
+String operator+(const String &a, const char *b);
+String operator+(const char *a, const String &b);
+String operator+(const String &a, char b);
+template <typename T>
+String operator+(const String &a, T b) { return a + String(b); }
+
+#endif
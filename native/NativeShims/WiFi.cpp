@@ -0,0 +1,130 @@
+#include "WiFi.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+String IPAddress::toString() const
+{
+  char text[16];
+  snprintf(text, sizeof(text), "%u.%u.%u.%u", address & 0xFF, address >> 8 & 0xFF, address >> 16 & 0xFF, address >> 24);
+  return String(text);
+}
+
+WiFiClient::~WiFiClient()
+{
+  stop();
+}
+
+int WiFiClient::connect(const char *host, uint16_t port)
+{
+  stop();
+  char service[6];
+  snprintf(service, sizeof(service), "%u", port);
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo *result;
+  if (getaddrinfo(host, service, &hints, &result) != 0)
+  {
+    return 0;
+  }
+  fd = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+  if (fd >= 0)
+  {
+    timeval tv = {(time_t)(timeout / 1000), (suseconds_t)(timeout % 1000 * 1000)};
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    if (::connect(fd, result->ai_addr, result->ai_addrlen) != 0)
+    {
+      ::close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(result);
+  closed = false;
+  return fd >= 0;
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port)
+{
+  return connect(ip.toString().c_str(), port);
+}
+
+uint8_t WiFiClient::connected()
+{
+  if (fd < 0 || closed)
+  {
+    return available() > 0;
+  }
+  char c;
+  ssize_t n = recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+  {
+    closed = true;
+  }
+  return !closed || available() > 0;
+}
+
+int WiFiClient::available()
+{
+  if (fd < 0)
+  {
+    return 0;
+  }
+  int count = 0;
+  if (ioctl(fd, FIONREAD, &count) != 0)
+  {
+    return 0;
+  }
+  return count;
+}
+
+int WiFiClient::read()
+{
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size)
+{
+  if (fd < 0)
+  {
+    return -1;
+  }
+  ssize_t n = recv(fd, buffer, size, MSG_DONTWAIT);
+  if (n == 0)
+  {
+    closed = true;
+  }
+  return n > 0 ? n : -1;
+}
+
+size_t WiFiClient::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size)
+{
+  if (fd < 0)
+  {
+    return 0;
+  }
+  ssize_t n = send(fd, buffer, size, MSG_NOSIGNAL);
+  return n > 0 ? n : 0;
+}
+
+void WiFiClient::stop()
+{
+  if (fd >= 0)
+  {
+    ::close(fd);
+    fd = -1;
+  }
+}
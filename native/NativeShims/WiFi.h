@@ -0,0 +1,88 @@
+#ifndef _NATIVE_WIFI_H_
+#define _NATIVE_WIFI_H_
+
+#include "Arduino.h"
+
+typedef enum
+{
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum
+{
+  WIFI_OFF = 0,
+  WIFI_STA = 1
+} WiFiMode_t;
+
+class IPAddress
+{
+public:
+  IPAddress(uint32_t address = 0) : address(address) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  operator uint32_t() const { return address; }
+  uint8_t operator[](int index) const { return address >> (index * 8); }
+  String toString() const;
+  bool isSet() const { return address != 0; }
+
+private:
+  uint32_t address;
+};
+
+// The host network is always "connected"
+class WiFiClass
+{
+public:
+  wl_status_t status() { return WL_CONNECTED; }
+  wl_status_t begin(const char *ssid, const char *passphrase = nullptr, int32_t channel = 0, const uint8_t *bssid = nullptr, bool connect = true) { return WL_CONNECTED; }
+  bool disconnect(bool wifiOff = false) { return true; }
+  bool reconnect() { return true; }
+  bool mode(WiFiMode_t mode) { return true; }
+  bool hostname(const char *name) { return true; }
+  bool setHostname(const char *name) { return true; }
+  bool setAutoReconnect(bool autoReconnect) { return true; }
+  bool persistent(bool persistent) { return true; }
+  bool config(IPAddress local, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress()) { return true; }
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  IPAddress subnetMask() { return IPAddress(255, 0, 0, 0); }
+  IPAddress gatewayIP() { return IPAddress(127, 0, 0, 1); }
+  IPAddress dnsIP(uint8_t index = 0) { return IPAddress(127, 0, 0, 1); }
+  String macAddress() { return "00:00:00:00:00:00"; }
+  int32_t RSSI() { return -50; }
+  int32_t channel() { return 1; }
+  uint8_t *BSSID()
+  {
+    static uint8_t bssid[6] = {0x02, 0, 0, 0, 0, 1};
+    return bssid;
+  }
+};
+extern WiFiClass WiFi;
+
+// TCP client on top of BSD sockets, reads never block
+class WiFiClient : public Print
+{
+public:
+  ~WiFiClient();
+  int connect(const char *host, uint16_t port);
+  int connect(IPAddress ip, uint16_t port);
+  uint8_t connected();
+  int available();
+  int read();
+  int read(uint8_t *buffer, size_t size);
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
+  void stop();
+  void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+  void setNoDelay(bool noDelay) {}
+
+private:
+  int fd = -1;
+  bool closed = false;
+  unsigned long timeout = 5000;
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef _NATIVE_PGMSPACE_H_
+#define _NATIVE_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+// Flash is plain memory on the host
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define memcpy_P memcpy
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strlen_P strlen
+#define strcpy_P strcpy
+
+#endif
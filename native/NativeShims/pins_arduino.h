@@ -0,0 +1 @@
+// Nothing to map on the host
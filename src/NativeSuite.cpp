@@ -0,0 +1,434 @@
+#ifdef NATIVE
+// Renders every screen from fixture data on the host, times draw and flush,
+// counts allocations and compares the captured frames against golden PPMs.
+// The first screen must not allocate at all once the text cache is warm.
+//
+//   program --suite [--fixtures dir] [--record dir | --verify dir] [--repeat N]
+//
+// Record the goldens once, then every change to the render path has to pass
+// --verify, i.e. produce the very same pixels.
+
+#include <Arduino.h>
+#include <chrono>
+#include <stdio.h>
+#include <unistd.h>
+#include <NativePanel.h>
+#include <ST7789_SPI.h>
+#include <WeatherFetcher.h>
+#include <Widgets.h>
+#include "main.h"
+
+// Friday, 2025-10-17 10:30:00 UTC, matches the fixture observation times
+#define SUITE_EPOCH 1760697000
+
+extern ST7789_SPI tft;
+extern String TIMEZONE;
+extern Canvas gfx;
+extern MiniGrafx miniGrafx;
+extern Screen *screens[];
+extern int screenCount;
+extern Screen *shownScreen;
+
+static const char *SCREEN_NAMES[] = {"current weather", "current detail", "forecast 0-3", "forecast 4-7", "about"};
+
+static bool loadFixture(const String &path, WeatherModel *model, bool forecast)
+{
+  FILE *file = fopen(path.c_str(), "rb");
+  if (file == nullptr)
+  {
+    fprintf(stderr, "missing fixture %s\n", path.c_str());
+    return false;
+  }
+  // same hours updateData() asks for
+  static const uint8_t allowedHours[] = {12, 0};
+  WeatherParser parser;
+  parser.setAllowedHours(allowedHours, sizeof(allowedHours));
+  parser.begin(model, forecast);
+  int c;
+  while ((c = fgetc(file)) != EOF)
+  {
+    parser.parse(c);
+  }
+  fclose(file);
+  return true;
+}
+
+static uint64_t microsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// What the panel shows at construction, kept in a temporary PPM to compare
+// with what it shows later
+class PanelSnapshot
+{
+public:
+  PanelSnapshot(NativePanel *panel)
+  {
+    this->panel = panel;
+    descriptor = mkstemp(path);
+    saved = descriptor >= 0 && panel->savePpm(path);
+  }
+
+  ~PanelSnapshot()
+  {
+    if (descriptor >= 0)
+    {
+      close(descriptor);
+      remove(path);
+    }
+  }
+
+  boolean isSaved() const
+  {
+    return saved;
+  }
+
+  boolean matches() const
+  {
+    return saved && panel->comparePpm(path) == 0;
+  }
+
+private:
+  NativePanel *panel;
+  char path[24] = "/tmp/snapshot-XXXXXX";
+  int descriptor;
+  boolean saved;
+};
+
+// Saves what the panel shows, redraws the screen from an empty frame and
+// compares the two
+static const char *compareWithRedraw(NativePanel *panel, Screen *screen)
+{
+  PanelSnapshot snapshot(panel);
+  if (!snapshot.isSaved())
+  {
+    return "not written";
+  }
+  shownScreen = nullptr;
+  showScreen(screen);
+  screen->update(&gfx);
+  gfx.commit();
+  return snapshot.matches() ? "matches redraw" : "differs from redraw";
+}
+
+// Number of characters that leave different pixels. Comparing frames only
+// catches stale text if every character draws differently, a font renderer
+// stubbed out with blocks would let those comparisons pass regardless.
+static uint8_t countDistinctGlyphs(const char *chars)
+{
+  uint8_t count = strlen(chars);
+  uint32_t hashes[count];
+  uint8_t distinct = 0;
+  uint16_t height = min((uint16_t)pgm_read_byte(ArialMT_Plain_16 + 1), miniGrafx.getHeight());
+  miniGrafx.setFont(ArialMT_Plain_16);
+  miniGrafx.setTextAlignment(TEXT_ALIGN_LEFT);
+  miniGrafx.setColor(0xFFFF);
+  for (uint8_t i = 0; i < count; i++)
+  {
+    miniGrafx.fillBuffer(0);
+    char glyph[] = {chars[i], '\0'};
+    miniGrafx.drawString(0, 0, glyph);
+    uint32_t hash = 2166136261;
+    for (uint16_t y = 0; y < height; y++)
+    {
+      for (uint16_t x = 0; x < 32; x++)
+      {
+        hash = (hash ^ miniGrafx.getPixel(x, y)) * 16777619;
+      }
+    }
+    boolean seen = false;
+    for (uint8_t j = 0; j < i; j++)
+    {
+      seen |= hashes[j] == hash;
+    }
+    hashes[i] = hash;
+    distinct += !seen;
+  }
+  miniGrafx.fillBuffer(0);
+  return distinct;
+}
+
+int runSuite(NativePanel *panel, int argc, char **argv)
+{
+  String fixtures = "native/fixtures";
+  const char *record = nullptr;
+  const char *verify = nullptr;
+  uint16_t repeat = 20;
+  for (int i = 1; i < argc - 1; i++)
+  {
+    if (strcmp(argv[i], "--fixtures") == 0)
+    {
+      fixtures = argv[++i];
+    }
+    else if (strcmp(argv[i], "--record") == 0)
+    {
+      record = argv[++i];
+    }
+    else if (strcmp(argv[i], "--verify") == 0)
+    {
+      verify = argv[++i];
+    }
+    else if (strcmp(argv[i], "--repeat") == 0)
+    {
+      repeat = max(1, atoi(argv[++i]));
+    }
+  }
+
+  nativeFreezeClock(SUITE_EPOCH);
+  setenv("TZ", TIMEZONE.c_str(), 1);
+  tzset();
+
+  gfx.init();
+  gfx.setRotation(TFT_ROTATION);
+  tft.setDirtyRegions(gfx.getDirtyRegions());
+  initScreens();
+
+  static WeatherModel model;
+  if (!loadFixture(fixtures + "/weather.json", &model, false) ||
+      !loadFixture(fixtures + "/forecast.json", &model, true))
+  {
+    return 2;
+  }
+  showWeather(&model);
+
+  int failures = 0;
+  const char *glyphs = "0123456789:";
+  uint8_t distinct = countDistinctGlyphs(glyphs);
+  if (distinct < strlen(glyphs))
+  {
+    printf("only %u of the characters \"%s\" draw differently, redraw comparisons would miss stale text\n",
+           distinct, glyphs);
+    failures++;
+  }
+  printf("%-16s %9s %9s %7s %11s %10s  %s\n", "screen", "draw us", "flush us", "allocs", "alloc bytes", "bus bytes", "golden");
+  for (int screen = 0; screen < screenCount; screen++)
+  {
+    uint64_t bestDraw = UINT64_MAX;
+    uint64_t bestFlush = UINT64_MAX;
+    uint32_t allocations = 0;
+    uint64_t allocatedBytes = 0;
+    uint64_t busBytes = 0;
+    for (uint16_t run = 0; run < repeat; run++)
+    {
+      SPI.resetCounters();
+      uint32_t allocationsBefore = nativeAllocations();
+      uint64_t bytesBefore = nativeAllocatedBytes();
+
+      // a full redraw from an empty frame, as after switching screens
+      auto start = std::chrono::steady_clock::now();
+      shownScreen = nullptr;
+      showScreen(screens[screen]);
+      screens[screen]->update(&gfx);
+      bestDraw = min(bestDraw, microsSince(start));
+
+      // and all of it sent, later runs would otherwise find nothing changed
+      gfx.invalidate();
+      start = std::chrono::steady_clock::now();
+      gfx.commit();
+      bestFlush = min(bestFlush, microsSince(start));
+
+      allocations = nativeAllocations() - allocationsBefore;
+      allocatedBytes = nativeAllocatedBytes() - bytesBefore;
+      busBytes = SPI.getBytes();
+    }
+
+    String golden;
+    const char *result = "-";
+    if (record != nullptr)
+    {
+      golden = String(record) + "/screen-" + String(screen) + ".ppm";
+      result = panel->savePpm(golden.c_str()) ? "recorded" : "not written";
+      failures += result[0] == 'n';
+    }
+    else if (verify != nullptr)
+    {
+      golden = String(verify) + "/screen-" + String(screen) + ".ppm";
+      int32_t mismatches = panel->comparePpm(golden.c_str());
+      static char text[32];
+      if (mismatches < 0)
+      {
+        result = "missing";
+      }
+      else if (mismatches == 0)
+      {
+        result = "match";
+      }
+      else
+      {
+        snprintf(text, sizeof(text), "%d pixels differ", mismatches);
+        result = text;
+      }
+      failures += mismatches != 0;
+    }
+    printf("%-16s %9llu %9llu %7u %11llu %10llu  %s\n", SCREEN_NAMES[screen], (unsigned long long)bestDraw,
+           (unsigned long long)bestFlush, allocations, (unsigned long long)allocatedBytes, (unsigned long long)busBytes, result);
+    if (screen == 0 && repeat > 1 && allocations > 0)
+    {
+      // the clock redraws this screen every second, heap churn there adds up
+      printf("%s allocated %u times in one frame, expected none\n", SCREEN_NAMES[screen], allocations);
+      failures++;
+    }
+  }
+
+  // what the clock costs once a second on the current weather screen
+  shownScreen = nullptr;
+  showScreen(screens[0]);
+  screens[0]->update(&gfx);
+  gfx.commit();
+  delay(1000);
+  SPI.resetCounters();
+  uint32_t allocationsBefore = nativeAllocations();
+  auto start = std::chrono::steady_clock::now();
+  screens[0]->update(&gfx);
+  uint64_t tickDraw = microsSince(start);
+  start = std::chrono::steady_clock::now();
+  gfx.commit();
+  printf("%-16s %9llu %9llu %7u %11s %10llu\n", "clock tick", (unsigned long long)tickDraw,
+         (unsigned long long)microsSince(start), nativeAllocations() - allocationsBefore, "-",
+         (unsigned long long)SPI.getBytes());
+
+  // the next forecast frame moving in once the first one was shown for five
+  // seconds, at the loop's 30 frames per second. Bus bytes are per step.
+  // Once it is in, the panel has to show the same pixels as a full redraw.
+  delay(4000);
+  screens[0]->update(&gfx);
+  gfx.commit();
+  const uint16_t steps = 16;
+  uint64_t stepDraw = 0;
+  uint64_t stepFlush = 0;
+  SPI.resetCounters();
+  allocationsBefore = nativeAllocations();
+  for (uint16_t step = 0; step < steps; step++)
+  {
+    delay(1000 / 30);
+    start = std::chrono::steady_clock::now();
+    screens[0]->update(&gfx);
+    stepDraw += microsSince(start);
+    start = std::chrono::steady_clock::now();
+    gfx.commit();
+    stepFlush += microsSince(start);
+  }
+  uint64_t stepBytes = SPI.getBytes() / steps;
+  uint32_t stepAllocations = nativeAllocations() - allocationsBefore;
+  const char *transition = compareWithRedraw(panel, screens[0]);
+  failures += transition[0] != 'm';
+  printf("%-16s %9llu %9llu %7u %11s %10llu  %s\n", "carousel step", (unsigned long long)(stepDraw / steps),
+         (unsigned long long)(stepFlush / steps), stepAllocations, "-", (unsigned long long)stepBytes, transition);
+
+  // clock ticks over two minutes, each digit redrawn in place as it changes,
+  // have to leave the same pixels as a full redraw. The 110 seconds are 20
+  // carousel cycles, so the carousel is not caught in a transition, which a
+  // redraw would start over.
+  const uint16_t ticks = 110;
+  uint64_t tickBytes = 0;
+  for (uint16_t tick = 0; tick < ticks; tick++)
+  {
+    delay(1000);
+    SPI.resetCounters();
+    screens[0]->update(&gfx);
+    gfx.commit();
+    tickBytes += SPI.getBytes();
+  }
+  const char *ticked = compareWithRedraw(panel, screens[0]);
+  failures += ticked[0] != 'm';
+  printf("%-16s %9s %9s %7s %11s %10llu  %s\n", "clock ticks", "-", "-", "-", "-",
+         (unsigned long long)(tickBytes / ticks), ticked);
+
+  // each screen drawn again while recording into a display list, then the
+  // list replayed band by band as 24 row bands would, and as a whole. The
+  // whole replay has to show the same pixels as the recorded draw.
+  printf("\n%-16s %9s %9s %9s %7s %8s %8s  %s\n", "display list", "record us", "replay us", "bands us", "bytes",
+         "commands", "per band", "replay");
+  static DisplayList list;
+  const uint16_t bandRows = 24;
+  for (int screen = 0; screen < screenCount; screen++)
+  {
+    uint64_t bestRecord = UINT64_MAX;
+    uint64_t bestReplay = UINT64_MAX;
+    uint64_t bestBands = UINT64_MAX;
+    uint32_t bandCommands = 0;
+    uint16_t bands = 0;
+    for (uint16_t run = 0; run < repeat; run++)
+    {
+      list.clear();
+      start = std::chrono::steady_clock::now();
+      gfx.setDisplayList(&list);
+      shownScreen = nullptr;
+      showScreen(screens[screen]);
+      screens[screen]->update(&gfx);
+      gfx.setDisplayList(nullptr);
+      bestRecord = min(bestRecord, microsSince(start));
+      gfx.commit();
+
+      bandCommands = 0;
+      bands = 0;
+      start = std::chrono::steady_clock::now();
+      for (int16_t top = 0; top < gfx.getHeight(); top += bandRows)
+      {
+        bandCommands += list.replay(&gfx, 0, top, gfx.getWidth(), bandRows);
+        bands++;
+      }
+      bestBands = min(bestBands, microsSince(start));
+
+      start = std::chrono::steady_clock::now();
+      list.replay(&gfx);
+      bestReplay = min(bestReplay, microsSince(start));
+    }
+
+    const char *result = "not written";
+    PanelSnapshot drawn(panel);
+    if (drawn.isSaved())
+    {
+      gfx.invalidate();
+      gfx.commit();
+      result = list.hasOverflowed() ? "overflowed" : drawn.matches() ? "matches draw" : "differs from draw";
+    }
+    failures += result[0] != 'm';
+    printf("%-16s %9llu %9llu %9llu %7u %8u %8u  %s\n", SCREEN_NAMES[screen], (unsigned long long)bestRecord,
+           (unsigned long long)bestReplay, (unsigned long long)bestBands, (unsigned)list.size(), list.count(),
+           bandCommands / bands, result);
+  }
+
+  // a clock tick recorded into a list, then replayed clipped to the clock
+  // rows onto the frame before it. The digits it changes have to be cleared
+  // as the tick cleared them, with the widgets' transparency switched off.
+  static DisplayList tickList;
+  list.clear();
+  gfx.setDisplayList(&list);
+  shownScreen = nullptr;
+  showScreen(screens[0]);
+  screens[0]->update(&gfx);
+  gfx.setDisplayList(nullptr);
+  gfx.commit();
+  delay(1000);
+  tickList.clear();
+  start = std::chrono::steady_clock::now();
+  gfx.setDisplayList(&tickList);
+  screens[0]->update(&gfx);
+  gfx.setDisplayList(nullptr);
+  uint64_t tickRecord = microsSince(start);
+  gfx.commit();
+  PanelSnapshot tickFrame(panel);
+  list.replay(&gfx);
+  start = std::chrono::steady_clock::now();
+  uint16_t tickCommands = tickList.replay(&gfx, 0, 0, gfx.getWidth(), 60);
+  uint64_t tickReplay = microsSince(start);
+  const char *tickResult = "not written";
+  if (tickFrame.isSaved())
+  {
+    gfx.invalidate();
+    gfx.commit();
+    tickResult = tickList.hasOverflowed() ? "overflowed" : tickFrame.matches() ? "matches draw" : "differs from draw";
+  }
+  failures += tickResult[0] != 'm';
+  printf("%-16s %9llu %9llu %9s %7u %8u %8u  %s\n", "clock tick", (unsigned long long)tickRecord,
+         (unsigned long long)tickReplay, "-", (unsigned)tickList.size(), tickList.count(), tickCommands, tickResult);
+
+  TextCache *textCache = gfx.getTextCache();
+  printf("text cache: %u hits, %u misses, %u runs in %u bytes\n", textCache->getHits(), textCache->getMisses(),
+         textCache->count(), (unsigned)textCache->getBytesUsed());
+  return failures > 0 ? 1 : 0;
+}
+
+#endif
@@ -1,6 +1,6 @@
 #pragma once
 
-// auto-generated by ThingPulse on Sun May  9 18:00:18 UTC 2021
+// auto-generated by tools/gen_tzinfo.py on Sat Oct 17 00:12:06 UTC 2026
 //
 // This database is auto-generated from
 //    https://raw.githubusercontent.com/nayarsystems/posix_tz_db/master/zones.csv
@@ -9,467 +9,1069 @@
 
 #include <Arduino.h>
 
-String getTzInfo(const String timezone) {
-  if (timezone == "Africa/Abidjan")	return PSTR("GMT0");
-  if (timezone == "Africa/Accra")	return PSTR("GMT0");
-  if (timezone == "Africa/Addis_Ababa")	return PSTR("EAT-3");
-  if (timezone == "Africa/Algiers")	return PSTR("CET-1");
-  if (timezone == "Africa/Asmara")	return PSTR("EAT-3");
-  if (timezone == "Africa/Bamako")	return PSTR("GMT0");
-  if (timezone == "Africa/Bangui")	return PSTR("WAT-1");
-  if (timezone == "Africa/Banjul")	return PSTR("GMT0");
-  if (timezone == "Africa/Bissau")	return PSTR("GMT0");
-  if (timezone == "Africa/Blantyre")	return PSTR("CAT-2");
-  if (timezone == "Africa/Brazzaville")	return PSTR("WAT-1");
-  if (timezone == "Africa/Bujumbura")	return PSTR("CAT-2");
-  if (timezone == "Africa/Cairo")	return PSTR("EET-2");
-  if (timezone == "Africa/Casablanca")	return PSTR("<+01>-1");
-  if (timezone == "Africa/Ceuta")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Africa/Conakry")	return PSTR("GMT0");
-  if (timezone == "Africa/Dakar")	return PSTR("GMT0");
-  if (timezone == "Africa/Dar_es_Salaam")	return PSTR("EAT-3");
-  if (timezone == "Africa/Djibouti")	return PSTR("EAT-3");
-  if (timezone == "Africa/Douala")	return PSTR("WAT-1");
-  if (timezone == "Africa/El_Aaiun")	return PSTR("<+01>-1");
-  if (timezone == "Africa/Freetown")	return PSTR("GMT0");
-  if (timezone == "Africa/Gaborone")	return PSTR("CAT-2");
-  if (timezone == "Africa/Harare")	return PSTR("CAT-2");
-  if (timezone == "Africa/Johannesburg")	return PSTR("SAST-2");
-  if (timezone == "Africa/Juba")	return PSTR("EAT-3");
-  if (timezone == "Africa/Kampala")	return PSTR("EAT-3");
-  if (timezone == "Africa/Khartoum")	return PSTR("CAT-2");
-  if (timezone == "Africa/Kigali")	return PSTR("CAT-2");
-  if (timezone == "Africa/Kinshasa")	return PSTR("WAT-1");
-  if (timezone == "Africa/Lagos")	return PSTR("WAT-1");
-  if (timezone == "Africa/Libreville")	return PSTR("WAT-1");
-  if (timezone == "Africa/Lome")	return PSTR("GMT0");
-  if (timezone == "Africa/Luanda")	return PSTR("WAT-1");
-  if (timezone == "Africa/Lubumbashi")	return PSTR("CAT-2");
-  if (timezone == "Africa/Lusaka")	return PSTR("CAT-2");
-  if (timezone == "Africa/Malabo")	return PSTR("WAT-1");
-  if (timezone == "Africa/Maputo")	return PSTR("CAT-2");
-  if (timezone == "Africa/Maseru")	return PSTR("SAST-2");
-  if (timezone == "Africa/Mbabane")	return PSTR("SAST-2");
-  if (timezone == "Africa/Mogadishu")	return PSTR("EAT-3");
-  if (timezone == "Africa/Monrovia")	return PSTR("GMT0");
-  if (timezone == "Africa/Nairobi")	return PSTR("EAT-3");
-  if (timezone == "Africa/Ndjamena")	return PSTR("WAT-1");
-  if (timezone == "Africa/Niamey")	return PSTR("WAT-1");
-  if (timezone == "Africa/Nouakchott")	return PSTR("GMT0");
-  if (timezone == "Africa/Ouagadougou")	return PSTR("GMT0");
-  if (timezone == "Africa/Porto-Novo")	return PSTR("WAT-1");
-  if (timezone == "Africa/Sao_Tome")	return PSTR("GMT0");
-  if (timezone == "Africa/Tripoli")	return PSTR("EET-2");
-  if (timezone == "Africa/Tunis")	return PSTR("CET-1");
-  if (timezone == "Africa/Windhoek")	return PSTR("CAT-2");
-  if (timezone == "America/Adak")	return PSTR("HST10HDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Anchorage")	return PSTR("AKST9AKDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Anguilla")	return PSTR("AST4");
-  if (timezone == "America/Antigua")	return PSTR("AST4");
-  if (timezone == "America/Araguaina")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Buenos_Aires")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Catamarca")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Cordoba")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Jujuy")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/La_Rioja")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Mendoza")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Rio_Gallegos")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Salta")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/San_Juan")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/San_Luis")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Tucuman")	return PSTR("<-03>3");
-  if (timezone == "America/Argentina/Ushuaia")	return PSTR("<-03>3");
-  if (timezone == "America/Aruba")	return PSTR("AST4");
-  if (timezone == "America/Asuncion")	return PSTR("<-04>4<-03>,M10.1.0/0,M3.4.0/0");
-  if (timezone == "America/Atikokan")	return PSTR("EST5");
-  if (timezone == "America/Bahia")	return PSTR("<-03>3");
-  if (timezone == "America/Bahia_Banderas")	return PSTR("CST6CDT,M4.1.0,M10.5.0");
-  if (timezone == "America/Barbados")	return PSTR("AST4");
-  if (timezone == "America/Belem")	return PSTR("<-03>3");
-  if (timezone == "America/Belize")	return PSTR("CST6");
-  if (timezone == "America/Blanc-Sablon")	return PSTR("AST4");
-  if (timezone == "America/Boa_Vista")	return PSTR("<-04>4");
-  if (timezone == "America/Bogota")	return PSTR("<-05>5");
-  if (timezone == "America/Boise")	return PSTR("MST7MDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Cambridge_Bay")	return PSTR("MST7MDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Campo_Grande")	return PSTR("<-04>4");
-  if (timezone == "America/Cancun")	return PSTR("EST5");
-  if (timezone == "America/Caracas")	return PSTR("<-04>4");
-  if (timezone == "America/Cayenne")	return PSTR("<-03>3");
-  if (timezone == "America/Cayman")	return PSTR("EST5");
-  if (timezone == "America/Chicago")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Chihuahua")	return PSTR("MST7MDT,M4.1.0,M10.5.0");
-  if (timezone == "America/Costa_Rica")	return PSTR("CST6");
-  if (timezone == "America/Creston")	return PSTR("MST7");
-  if (timezone == "America/Cuiaba")	return PSTR("<-04>4");
-  if (timezone == "America/Curacao")	return PSTR("AST4");
-  if (timezone == "America/Danmarkshavn")	return PSTR("GMT0");
-  if (timezone == "America/Dawson")	return PSTR("MST7");
-  if (timezone == "America/Dawson_Creek")	return PSTR("MST7");
-  if (timezone == "America/Denver")	return PSTR("MST7MDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Detroit")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Dominica")	return PSTR("AST4");
-  if (timezone == "America/Edmonton")	return PSTR("MST7MDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Eirunepe")	return PSTR("<-05>5");
-  if (timezone == "America/El_Salvador")	return PSTR("CST6");
-  if (timezone == "America/Fortaleza")	return PSTR("<-03>3");
-  if (timezone == "America/Fort_Nelson")	return PSTR("MST7");
-  if (timezone == "America/Glace_Bay")	return PSTR("AST4ADT,M3.2.0,M11.1.0");
-  if (timezone == "America/Godthab")	return PSTR("<-03>3<-02>,M3.5.0/-2,M10.5.0/-1");
-  if (timezone == "America/Goose_Bay")	return PSTR("AST4ADT,M3.2.0,M11.1.0");
-  if (timezone == "America/Grand_Turk")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Grenada")	return PSTR("AST4");
-  if (timezone == "America/Guadeloupe")	return PSTR("AST4");
-  if (timezone == "America/Guatemala")	return PSTR("CST6");
-  if (timezone == "America/Guayaquil")	return PSTR("<-05>5");
-  if (timezone == "America/Guyana")	return PSTR("<-04>4");
-  if (timezone == "America/Halifax")	return PSTR("AST4ADT,M3.2.0,M11.1.0");
-  if (timezone == "America/Havana")	return PSTR("CST5CDT,M3.2.0/0,M11.1.0/1");
-  if (timezone == "America/Hermosillo")	return PSTR("MST7");
-  if (timezone == "America/Indiana/Indianapolis")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Indiana/Knox")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Indiana/Marengo")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Indiana/Petersburg")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Indiana/Tell_City")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Indiana/Vevay")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Indiana/Vincennes")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Indiana/Winamac")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Inuvik")	return PSTR("MST7MDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Iqaluit")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Jamaica")	return PSTR("EST5");
-  if (timezone == "America/Juneau")	return PSTR("AKST9AKDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Kentucky/Louisville")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Kentucky/Monticello")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Kralendijk")	return PSTR("AST4");
-  if (timezone == "America/La_Paz")	return PSTR("<-04>4");
-  if (timezone == "America/Lima")	return PSTR("<-05>5");
-  if (timezone == "America/Los_Angeles")	return PSTR("PST8PDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Lower_Princes")	return PSTR("AST4");
-  if (timezone == "America/Maceio")	return PSTR("<-03>3");
-  if (timezone == "America/Managua")	return PSTR("CST6");
-  if (timezone == "America/Manaus")	return PSTR("<-04>4");
-  if (timezone == "America/Marigot")	return PSTR("AST4");
-  if (timezone == "America/Martinique")	return PSTR("AST4");
-  if (timezone == "America/Matamoros")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Mazatlan")	return PSTR("MST7MDT,M4.1.0,M10.5.0");
-  if (timezone == "America/Menominee")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Merida")	return PSTR("CST6CDT,M4.1.0,M10.5.0");
-  if (timezone == "America/Metlakatla")	return PSTR("AKST9AKDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Mexico_City")	return PSTR("CST6CDT,M4.1.0,M10.5.0");
-  if (timezone == "America/Miquelon")	return PSTR("<-03>3<-02>,M3.2.0,M11.1.0");
-  if (timezone == "America/Moncton")	return PSTR("AST4ADT,M3.2.0,M11.1.0");
-  if (timezone == "America/Monterrey")	return PSTR("CST6CDT,M4.1.0,M10.5.0");
-  if (timezone == "America/Montevideo")	return PSTR("<-03>3");
-  if (timezone == "America/Montreal")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Montserrat")	return PSTR("AST4");
-  if (timezone == "America/Nassau")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/New_York")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Nipigon")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Nome")	return PSTR("AKST9AKDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Noronha")	return PSTR("<-02>2");
-  if (timezone == "America/North_Dakota/Beulah")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/North_Dakota/Center")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/North_Dakota/New_Salem")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Nuuk")	return PSTR("<-03>3<-02>,M3.5.0/-2,M10.5.0/-1");
-  if (timezone == "America/Ojinaga")	return PSTR("MST7MDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Panama")	return PSTR("EST5");
-  if (timezone == "America/Pangnirtung")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Paramaribo")	return PSTR("<-03>3");
-  if (timezone == "America/Phoenix")	return PSTR("MST7");
-  if (timezone == "America/Port-au-Prince")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Port_of_Spain")	return PSTR("AST4");
-  if (timezone == "America/Porto_Velho")	return PSTR("<-04>4");
-  if (timezone == "America/Puerto_Rico")	return PSTR("AST4");
-  if (timezone == "America/Punta_Arenas")	return PSTR("<-03>3");
-  if (timezone == "America/Rainy_River")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Rankin_Inlet")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Recife")	return PSTR("<-03>3");
-  if (timezone == "America/Regina")	return PSTR("CST6");
-  if (timezone == "America/Resolute")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Rio_Branco")	return PSTR("<-05>5");
-  if (timezone == "America/Santarem")	return PSTR("<-03>3");
-  if (timezone == "America/Santiago")	return PSTR("<-04>4<-03>,M9.1.6/24,M4.1.6/24");
-  if (timezone == "America/Santo_Domingo")	return PSTR("AST4");
-  if (timezone == "America/Sao_Paulo")	return PSTR("<-03>3");
-  if (timezone == "America/Scoresbysund")	return PSTR("<-01>1<+00>,M3.5.0/0,M10.5.0/1");
-  if (timezone == "America/Sitka")	return PSTR("AKST9AKDT,M3.2.0,M11.1.0");
-  if (timezone == "America/St_Barthelemy")	return PSTR("AST4");
-  if (timezone == "America/St_Johns")	return PSTR("NST3:30NDT,M3.2.0,M11.1.0");
-  if (timezone == "America/St_Kitts")	return PSTR("AST4");
-  if (timezone == "America/St_Lucia")	return PSTR("AST4");
-  if (timezone == "America/St_Thomas")	return PSTR("AST4");
-  if (timezone == "America/St_Vincent")	return PSTR("AST4");
-  if (timezone == "America/Swift_Current")	return PSTR("CST6");
-  if (timezone == "America/Tegucigalpa")	return PSTR("CST6");
-  if (timezone == "America/Thule")	return PSTR("AST4ADT,M3.2.0,M11.1.0");
-  if (timezone == "America/Thunder_Bay")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Tijuana")	return PSTR("PST8PDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Toronto")	return PSTR("EST5EDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Tortola")	return PSTR("AST4");
-  if (timezone == "America/Vancouver")	return PSTR("PST8PDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Whitehorse")	return PSTR("MST7");
-  if (timezone == "America/Winnipeg")	return PSTR("CST6CDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Yakutat")	return PSTR("AKST9AKDT,M3.2.0,M11.1.0");
-  if (timezone == "America/Yellowknife")	return PSTR("MST7MDT,M3.2.0,M11.1.0");
-  if (timezone == "Antarctica/Casey")	return PSTR("<+11>-11");
-  if (timezone == "Antarctica/Davis")	return PSTR("<+07>-7");
-  if (timezone == "Antarctica/DumontDUrville")	return PSTR("<+10>-10");
-  if (timezone == "Antarctica/Macquarie")	return PSTR("AEST-10AEDT,M10.1.0,M4.1.0/3");
-  if (timezone == "Antarctica/Mawson")	return PSTR("<+05>-5");
-  if (timezone == "Antarctica/McMurdo")	return PSTR("NZST-12NZDT,M9.5.0,M4.1.0/3");
-  if (timezone == "Antarctica/Palmer")	return PSTR("<-03>3");
-  if (timezone == "Antarctica/Rothera")	return PSTR("<-03>3");
-  if (timezone == "Antarctica/Syowa")	return PSTR("<+03>-3");
-  if (timezone == "Antarctica/Troll")	return PSTR("<+00>0<+02>-2,M3.5.0/1,M10.5.0/3");
-  if (timezone == "Antarctica/Vostok")	return PSTR("<+06>-6");
-  if (timezone == "Arctic/Longyearbyen")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Asia/Aden")	return PSTR("<+03>-3");
-  if (timezone == "Asia/Almaty")	return PSTR("<+06>-6");
-  if (timezone == "Asia/Amman")	return PSTR("EET-2EEST,M3.5.4/24,M10.5.5/1");
-  if (timezone == "Asia/Anadyr")	return PSTR("<+12>-12");
-  if (timezone == "Asia/Aqtau")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Aqtobe")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Ashgabat")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Atyrau")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Baghdad")	return PSTR("<+03>-3");
-  if (timezone == "Asia/Bahrain")	return PSTR("<+03>-3");
-  if (timezone == "Asia/Baku")	return PSTR("<+04>-4");
-  if (timezone == "Asia/Bangkok")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Barnaul")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Beirut")	return PSTR("EET-2EEST,M3.5.0/0,M10.5.0/0");
-  if (timezone == "Asia/Bishkek")	return PSTR("<+06>-6");
-  if (timezone == "Asia/Brunei")	return PSTR("<+08>-8");
-  if (timezone == "Asia/Chita")	return PSTR("<+09>-9");
-  if (timezone == "Asia/Choibalsan")	return PSTR("<+08>-8");
-  if (timezone == "Asia/Colombo")	return PSTR("<+0530>-5:30");
-  if (timezone == "Asia/Damascus")	return PSTR("EET-2EEST,M3.5.5/0,M10.5.5/0");
-  if (timezone == "Asia/Dhaka")	return PSTR("<+06>-6");
-  if (timezone == "Asia/Dili")	return PSTR("<+09>-9");
-  if (timezone == "Asia/Dubai")	return PSTR("<+04>-4");
-  if (timezone == "Asia/Dushanbe")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Famagusta")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Asia/Gaza")	return PSTR("EET-2EEST,M3.4.4/48,M10.4.4/49");
-  if (timezone == "Asia/Hebron")	return PSTR("EET-2EEST,M3.4.4/48,M10.4.4/49");
-  if (timezone == "Asia/Ho_Chi_Minh")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Hong_Kong")	return PSTR("HKT-8");
-  if (timezone == "Asia/Hovd")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Irkutsk")	return PSTR("<+08>-8");
-  if (timezone == "Asia/Jakarta")	return PSTR("WIB-7");
-  if (timezone == "Asia/Jayapura")	return PSTR("WIT-9");
-  if (timezone == "Asia/Jerusalem")	return PSTR("IST-2IDT,M3.4.4/26,M10.5.0");
-  if (timezone == "Asia/Kabul")	return PSTR("<+0430>-4:30");
-  if (timezone == "Asia/Kamchatka")	return PSTR("<+12>-12");
-  if (timezone == "Asia/Karachi")	return PSTR("PKT-5");
-  if (timezone == "Asia/Kathmandu")	return PSTR("<+0545>-5:45");
-  if (timezone == "Asia/Khandyga")	return PSTR("<+09>-9");
-  if (timezone == "Asia/Kolkata")	return PSTR("IST-5:30");
-  if (timezone == "Asia/Krasnoyarsk")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Kuala_Lumpur")	return PSTR("<+08>-8");
-  if (timezone == "Asia/Kuching")	return PSTR("<+08>-8");
-  if (timezone == "Asia/Kuwait")	return PSTR("<+03>-3");
-  if (timezone == "Asia/Macau")	return PSTR("CST-8");
-  if (timezone == "Asia/Magadan")	return PSTR("<+11>-11");
-  if (timezone == "Asia/Makassar")	return PSTR("WITA-8");
-  if (timezone == "Asia/Manila")	return PSTR("PST-8");
-  if (timezone == "Asia/Muscat")	return PSTR("<+04>-4");
-  if (timezone == "Asia/Nicosia")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Asia/Novokuznetsk")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Novosibirsk")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Omsk")	return PSTR("<+06>-6");
-  if (timezone == "Asia/Oral")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Phnom_Penh")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Pontianak")	return PSTR("WIB-7");
-  if (timezone == "Asia/Pyongyang")	return PSTR("KST-9");
-  if (timezone == "Asia/Qatar")	return PSTR("<+03>-3");
-  if (timezone == "Asia/Qyzylorda")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Riyadh")	return PSTR("<+03>-3");
-  if (timezone == "Asia/Sakhalin")	return PSTR("<+11>-11");
-  if (timezone == "Asia/Samarkand")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Seoul")	return PSTR("KST-9");
-  if (timezone == "Asia/Shanghai")	return PSTR("CST-8");
-  if (timezone == "Asia/Singapore")	return PSTR("<+08>-8");
-  if (timezone == "Asia/Srednekolymsk")	return PSTR("<+11>-11");
-  if (timezone == "Asia/Taipei")	return PSTR("CST-8");
-  if (timezone == "Asia/Tashkent")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Tbilisi")	return PSTR("<+04>-4");
-  if (timezone == "Asia/Tehran")	return PSTR("<+0330>-3:30<+0430>,J79/24,J263/24");
-  if (timezone == "Asia/Thimphu")	return PSTR("<+06>-6");
-  if (timezone == "Asia/Tokyo")	return PSTR("JST-9");
-  if (timezone == "Asia/Tomsk")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Ulaanbaatar")	return PSTR("<+08>-8");
-  if (timezone == "Asia/Urumqi")	return PSTR("<+06>-6");
-  if (timezone == "Asia/Ust-Nera")	return PSTR("<+10>-10");
-  if (timezone == "Asia/Vientiane")	return PSTR("<+07>-7");
-  if (timezone == "Asia/Vladivostok")	return PSTR("<+10>-10");
-  if (timezone == "Asia/Yakutsk")	return PSTR("<+09>-9");
-  if (timezone == "Asia/Yangon")	return PSTR("<+0630>-6:30");
-  if (timezone == "Asia/Yekaterinburg")	return PSTR("<+05>-5");
-  if (timezone == "Asia/Yerevan")	return PSTR("<+04>-4");
-  if (timezone == "Atlantic/Azores")	return PSTR("<-01>1<+00>,M3.5.0/0,M10.5.0/1");
-  if (timezone == "Atlantic/Bermuda")	return PSTR("AST4ADT,M3.2.0,M11.1.0");
-  if (timezone == "Atlantic/Canary")	return PSTR("WET0WEST,M3.5.0/1,M10.5.0");
-  if (timezone == "Atlantic/Cape_Verde")	return PSTR("<-01>1");
-  if (timezone == "Atlantic/Faroe")	return PSTR("WET0WEST,M3.5.0/1,M10.5.0");
-  if (timezone == "Atlantic/Madeira")	return PSTR("WET0WEST,M3.5.0/1,M10.5.0");
-  if (timezone == "Atlantic/Reykjavik")	return PSTR("GMT0");
-  if (timezone == "Atlantic/South_Georgia")	return PSTR("<-02>2");
-  if (timezone == "Atlantic/Stanley")	return PSTR("<-03>3");
-  if (timezone == "Atlantic/St_Helena")	return PSTR("GMT0");
-  if (timezone == "Australia/Adelaide")	return PSTR("ACST-9:30ACDT,M10.1.0,M4.1.0/3");
-  if (timezone == "Australia/Brisbane")	return PSTR("AEST-10");
-  if (timezone == "Australia/Broken_Hill")	return PSTR("ACST-9:30ACDT,M10.1.0,M4.1.0/3");
-  if (timezone == "Australia/Currie")	return PSTR("AEST-10AEDT,M10.1.0,M4.1.0/3");
-  if (timezone == "Australia/Darwin")	return PSTR("ACST-9:30");
-  if (timezone == "Australia/Eucla")	return PSTR("<+0845>-8:45");
-  if (timezone == "Australia/Hobart")	return PSTR("AEST-10AEDT,M10.1.0,M4.1.0/3");
-  if (timezone == "Australia/Lindeman")	return PSTR("AEST-10");
-  if (timezone == "Australia/Lord_Howe")	return PSTR("<+1030>-10:30<+11>-11,M10.1.0,M4.1.0");
-  if (timezone == "Australia/Melbourne")	return PSTR("AEST-10AEDT,M10.1.0,M4.1.0/3");
-  if (timezone == "Australia/Perth")	return PSTR("AWST-8");
-  if (timezone == "Australia/Sydney")	return PSTR("AEST-10AEDT,M10.1.0,M4.1.0/3");
-  if (timezone == "Europe/Amsterdam")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Andorra")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Astrakhan")	return PSTR("<+04>-4");
-  if (timezone == "Europe/Athens")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Belgrade")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Berlin")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Bratislava")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Brussels")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Bucharest")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Budapest")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Busingen")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Chisinau")	return PSTR("EET-2EEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Copenhagen")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Dublin")	return PSTR("IST-1GMT0,M10.5.0,M3.5.0/1");
-  if (timezone == "Europe/Gibraltar")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Guernsey")	return PSTR("GMT0BST,M3.5.0/1,M10.5.0");
-  if (timezone == "Europe/Helsinki")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Isle_of_Man")	return PSTR("GMT0BST,M3.5.0/1,M10.5.0");
-  if (timezone == "Europe/Istanbul")	return PSTR("<+03>-3");
-  if (timezone == "Europe/Jersey")	return PSTR("GMT0BST,M3.5.0/1,M10.5.0");
-  if (timezone == "Europe/Kaliningrad")	return PSTR("EET-2");
-  if (timezone == "Europe/Kiev")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Kirov")	return PSTR("<+03>-3");
-  if (timezone == "Europe/Lisbon")	return PSTR("WET0WEST,M3.5.0/1,M10.5.0");
-  if (timezone == "Europe/Ljubljana")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/London")	return PSTR("GMT0BST,M3.5.0/1,M10.5.0");
-  if (timezone == "Europe/Luxembourg")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Madrid")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Malta")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Mariehamn")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Minsk")	return PSTR("<+03>-3");
-  if (timezone == "Europe/Monaco")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Moscow")	return PSTR("MSK-3");
-  if (timezone == "Europe/Oslo")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Paris")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Podgorica")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Prague")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Riga")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Rome")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Samara")	return PSTR("<+04>-4");
-  if (timezone == "Europe/San_Marino")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Sarajevo")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Saratov")	return PSTR("<+04>-4");
-  if (timezone == "Europe/Simferopol")	return PSTR("MSK-3");
-  if (timezone == "Europe/Skopje")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Sofia")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Stockholm")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Tallinn")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Tirane")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Ulyanovsk")	return PSTR("<+04>-4");
-  if (timezone == "Europe/Uzhgorod")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Vaduz")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Vatican")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Vienna")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Vilnius")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Volgograd")	return PSTR("<+03>-3");
-  if (timezone == "Europe/Warsaw")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Zagreb")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Europe/Zaporozhye")	return PSTR("EET-2EEST,M3.5.0/3,M10.5.0/4");
-  if (timezone == "Europe/Zurich")	return PSTR("CET-1CEST,M3.5.0,M10.5.0/3");
-  if (timezone == "Indian/Antananarivo")	return PSTR("EAT-3");
-  if (timezone == "Indian/Chagos")	return PSTR("<+06>-6");
-  if (timezone == "Indian/Christmas")	return PSTR("<+07>-7");
-  if (timezone == "Indian/Cocos")	return PSTR("<+0630>-6:30");
-  if (timezone == "Indian/Comoro")	return PSTR("EAT-3");
-  if (timezone == "Indian/Kerguelen")	return PSTR("<+05>-5");
-  if (timezone == "Indian/Mahe")	return PSTR("<+04>-4");
-  if (timezone == "Indian/Maldives")	return PSTR("<+05>-5");
-  if (timezone == "Indian/Mauritius")	return PSTR("<+04>-4");
-  if (timezone == "Indian/Mayotte")	return PSTR("EAT-3");
-  if (timezone == "Indian/Reunion")	return PSTR("<+04>-4");
-  if (timezone == "Pacific/Apia")	return PSTR("<+13>-13<+14>,M9.5.0/3,M4.1.0/4");
-  if (timezone == "Pacific/Auckland")	return PSTR("NZST-12NZDT,M9.5.0,M4.1.0/3");
-  if (timezone == "Pacific/Bougainville")	return PSTR("<+11>-11");
-  if (timezone == "Pacific/Chatham")	return PSTR("<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45");
-  if (timezone == "Pacific/Chuuk")	return PSTR("<+10>-10");
-  if (timezone == "Pacific/Easter")	return PSTR("<-06>6<-05>,M9.1.6/22,M4.1.6/22");
-  if (timezone == "Pacific/Efate")	return PSTR("<+11>-11");
-  if (timezone == "Pacific/Enderbury")	return PSTR("<+13>-13");
-  if (timezone == "Pacific/Fakaofo")	return PSTR("<+13>-13");
-  if (timezone == "Pacific/Fiji")	return PSTR("<+12>-12<+13>,M11.2.0,M1.2.3/99");
-  if (timezone == "Pacific/Funafuti")	return PSTR("<+12>-12");
-  if (timezone == "Pacific/Galapagos")	return PSTR("<-06>6");
-  if (timezone == "Pacific/Gambier")	return PSTR("<-09>9");
-  if (timezone == "Pacific/Guadalcanal")	return PSTR("<+11>-11");
-  if (timezone == "Pacific/Guam")	return PSTR("ChST-10");
-  if (timezone == "Pacific/Honolulu")	return PSTR("HST10");
-  if (timezone == "Pacific/Kiritimati")	return PSTR("<+14>-14");
-  if (timezone == "Pacific/Kosrae")	return PSTR("<+11>-11");
-  if (timezone == "Pacific/Kwajalein")	return PSTR("<+12>-12");
-  if (timezone == "Pacific/Majuro")	return PSTR("<+12>-12");
-  if (timezone == "Pacific/Marquesas")	return PSTR("<-0930>9:30");
-  if (timezone == "Pacific/Midway")	return PSTR("SST11");
-  if (timezone == "Pacific/Nauru")	return PSTR("<+12>-12");
-  if (timezone == "Pacific/Niue")	return PSTR("<-11>11");
-  if (timezone == "Pacific/Norfolk")	return PSTR("<+11>-11<+12>,M10.1.0,M4.1.0/3");
-  if (timezone == "Pacific/Noumea")	return PSTR("<+11>-11");
-  if (timezone == "Pacific/Pago_Pago")	return PSTR("SST11");
-  if (timezone == "Pacific/Palau")	return PSTR("<+09>-9");
-  if (timezone == "Pacific/Pitcairn")	return PSTR("<-08>8");
-  if (timezone == "Pacific/Pohnpei")	return PSTR("<+11>-11");
-  if (timezone == "Pacific/Port_Moresby")	return PSTR("<+10>-10");
-  if (timezone == "Pacific/Rarotonga")	return PSTR("<-10>10");
-  if (timezone == "Pacific/Saipan")	return PSTR("ChST-10");
-  if (timezone == "Pacific/Tahiti")	return PSTR("<-10>10");
-  if (timezone == "Pacific/Tarawa")	return PSTR("<+12>-12");
-  if (timezone == "Pacific/Tongatapu")	return PSTR("<+13>-13");
-  if (timezone == "Pacific/Wake")	return PSTR("<+12>-12");
-  if (timezone == "Pacific/Wallis")	return PSTR("<+12>-12");
-  if (timezone == "Etc/GMT")	return PSTR("GMT0");
-  if (timezone == "Etc/GMT-0")	return PSTR("GMT0");
-  if (timezone == "Etc/GMT-1")	return PSTR("<+01>-1");
-  if (timezone == "Etc/GMT-2")	return PSTR("<+02>-2");
-  if (timezone == "Etc/GMT-3")	return PSTR("<+03>-3");
-  if (timezone == "Etc/GMT-4")	return PSTR("<+04>-4");
-  if (timezone == "Etc/GMT-5")	return PSTR("<+05>-5");
-  if (timezone == "Etc/GMT-6")	return PSTR("<+06>-6");
-  if (timezone == "Etc/GMT-7")	return PSTR("<+07>-7");
-  if (timezone == "Etc/GMT-8")	return PSTR("<+08>-8");
-  if (timezone == "Etc/GMT-9")	return PSTR("<+09>-9");
-  if (timezone == "Etc/GMT-10")	return PSTR("<+10>-10");
-  if (timezone == "Etc/GMT-11")	return PSTR("<+11>-11");
-  if (timezone == "Etc/GMT-12")	return PSTR("<+12>-12");
-  if (timezone == "Etc/GMT-13")	return PSTR("<+13>-13");
-  if (timezone == "Etc/GMT-14")	return PSTR("<+14>-14");
-  if (timezone == "Etc/GMT0")	return PSTR("GMT0");
-  if (timezone == "Etc/GMT+0")	return PSTR("GMT0");
-  if (timezone == "Etc/GMT+1")	return PSTR("<-01>1");
-  if (timezone == "Etc/GMT+2")	return PSTR("<-02>2");
-  if (timezone == "Etc/GMT+3")	return PSTR("<-03>3");
-  if (timezone == "Etc/GMT+4")	return PSTR("<-04>4");
-  if (timezone == "Etc/GMT+5")	return PSTR("<-05>5");
-  if (timezone == "Etc/GMT+6")	return PSTR("<-06>6");
-  if (timezone == "Etc/GMT+7")	return PSTR("<-07>7");
-  if (timezone == "Etc/GMT+8")	return PSTR("<-08>8");
-  if (timezone == "Etc/GMT+9")	return PSTR("<-09>9");
-  if (timezone == "Etc/GMT+10")	return PSTR("<-10>10");
-  if (timezone == "Etc/GMT+11")	return PSTR("<-11>11");
-  if (timezone == "Etc/GMT+12")	return PSTR("<-12>12");
-  if (timezone == "Etc/UCT")	return PSTR("UTC0");
-  if (timezone == "Etc/UTC")	return PSTR("UTC0");
-  if (timezone == "Etc/Greenwich")	return PSTR("GMT0");
-  if (timezone == "Etc/Universal")	return PSTR("UTC0");
-  if (timezone == "Etc/Zulu")	return PSTR("UTC0");
-  return PSTR("UTC0");
+// 461 zone names sorted in strcmp() order, NUL separated
+static const char TZ_NAMES[] PROGMEM =
+    "Africa/Abidjan\0"
+    "Africa/Accra\0"
+    "Africa/Addis_Ababa\0"
+    "Africa/Algiers\0"
+    "Africa/Asmara\0"
+    "Africa/Bamako\0"
+    "Africa/Bangui\0"
+    "Africa/Banjul\0"
+    "Africa/Bissau\0"
+    "Africa/Blantyre\0"
+    "Africa/Brazzaville\0"
+    "Africa/Bujumbura\0"
+    "Africa/Cairo\0"
+    "Africa/Casablanca\0"
+    "Africa/Ceuta\0"
+    "Africa/Conakry\0"
+    "Africa/Dakar\0"
+    "Africa/Dar_es_Salaam\0"
+    "Africa/Djibouti\0"
+    "Africa/Douala\0"
+    "Africa/El_Aaiun\0"
+    "Africa/Freetown\0"
+    "Africa/Gaborone\0"
+    "Africa/Harare\0"
+    "Africa/Johannesburg\0"
+    "Africa/Juba\0"
+    "Africa/Kampala\0"
+    "Africa/Khartoum\0"
+    "Africa/Kigali\0"
+    "Africa/Kinshasa\0"
+    "Africa/Lagos\0"
+    "Africa/Libreville\0"
+    "Africa/Lome\0"
+    "Africa/Luanda\0"
+    "Africa/Lubumbashi\0"
+    "Africa/Lusaka\0"
+    "Africa/Malabo\0"
+    "Africa/Maputo\0"
+    "Africa/Maseru\0"
+    "Africa/Mbabane\0"
+    "Africa/Mogadishu\0"
+    "Africa/Monrovia\0"
+    "Africa/Nairobi\0"
+    "Africa/Ndjamena\0"
+    "Africa/Niamey\0"
+    "Africa/Nouakchott\0"
+    "Africa/Ouagadougou\0"
+    "Africa/Porto-Novo\0"
+    "Africa/Sao_Tome\0"
+    "Africa/Tripoli\0"
+    "Africa/Tunis\0"
+    "Africa/Windhoek\0"
+    "America/Adak\0"
+    "America/Anchorage\0"
+    "America/Anguilla\0"
+    "America/Antigua\0"
+    "America/Araguaina\0"
+    "America/Argentina/Buenos_Aires\0"
+    "America/Argentina/Catamarca\0"
+    "America/Argentina/Cordoba\0"
+    "America/Argentina/Jujuy\0"
+    "America/Argentina/La_Rioja\0"
+    "America/Argentina/Mendoza\0"
+    "America/Argentina/Rio_Gallegos\0"
+    "America/Argentina/Salta\0"
+    "America/Argentina/San_Juan\0"
+    "America/Argentina/San_Luis\0"
+    "America/Argentina/Tucuman\0"
+    "America/Argentina/Ushuaia\0"
+    "America/Aruba\0"
+    "America/Asuncion\0"
+    "America/Atikokan\0"
+    "America/Bahia\0"
+    "America/Bahia_Banderas\0"
+    "America/Barbados\0"
+    "America/Belem\0"
+    "America/Belize\0"
+    "America/Blanc-Sablon\0"
+    "America/Boa_Vista\0"
+    "America/Bogota\0"
+    "America/Boise\0"
+    "America/Cambridge_Bay\0"
+    "America/Campo_Grande\0"
+    "America/Cancun\0"
+    "America/Caracas\0"
+    "America/Cayenne\0"
+    "America/Cayman\0"
+    "America/Chicago\0"
+    "America/Chihuahua\0"
+    "America/Costa_Rica\0"
+    "America/Creston\0"
+    "America/Cuiaba\0"
+    "America/Curacao\0"
+    "America/Danmarkshavn\0"
+    "America/Dawson\0"
+    "America/Dawson_Creek\0"
+    "America/Denver\0"
+    "America/Detroit\0"
+    "America/Dominica\0"
+    "America/Edmonton\0"
+    "America/Eirunepe\0"
+    "America/El_Salvador\0"
+    "America/Fort_Nelson\0"
+    "America/Fortaleza\0"
+    "America/Glace_Bay\0"
+    "America/Godthab\0"
+    "America/Goose_Bay\0"
+    "America/Grand_Turk\0"
+    "America/Grenada\0"
+    "America/Guadeloupe\0"
+    "America/Guatemala\0"
+    "America/Guayaquil\0"
+    "America/Guyana\0"
+    "America/Halifax\0"
+    "America/Havana\0"
+    "America/Hermosillo\0"
+    "America/Indiana/Indianapolis\0"
+    "America/Indiana/Knox\0"
+    "America/Indiana/Marengo\0"
+    "America/Indiana/Petersburg\0"
+    "America/Indiana/Tell_City\0"
+    "America/Indiana/Vevay\0"
+    "America/Indiana/Vincennes\0"
+    "America/Indiana/Winamac\0"
+    "America/Inuvik\0"
+    "America/Iqaluit\0"
+    "America/Jamaica\0"
+    "America/Juneau\0"
+    "America/Kentucky/Louisville\0"
+    "America/Kentucky/Monticello\0"
+    "America/Kralendijk\0"
+    "America/La_Paz\0"
+    "America/Lima\0"
+    "America/Los_Angeles\0"
+    "America/Lower_Princes\0"
+    "America/Maceio\0"
+    "America/Managua\0"
+    "America/Manaus\0"
+    "America/Marigot\0"
+    "America/Martinique\0"
+    "America/Matamoros\0"
+    "America/Mazatlan\0"
+    "America/Menominee\0"
+    "America/Merida\0"
+    "America/Metlakatla\0"
+    "America/Mexico_City\0"
+    "America/Miquelon\0"
+    "America/Moncton\0"
+    "America/Monterrey\0"
+    "America/Montevideo\0"
+    "America/Montreal\0"
+    "America/Montserrat\0"
+    "America/Nassau\0"
+    "America/New_York\0"
+    "America/Nipigon\0"
+    "America/Nome\0"
+    "America/Noronha\0"
+    "America/North_Dakota/Beulah\0"
+    "America/North_Dakota/Center\0"
+    "America/North_Dakota/New_Salem\0"
+    "America/Nuuk\0"
+    "America/Ojinaga\0"
+    "America/Panama\0"
+    "America/Pangnirtung\0"
+    "America/Paramaribo\0"
+    "America/Phoenix\0"
+    "America/Port-au-Prince\0"
+    "America/Port_of_Spain\0"
+    "America/Porto_Velho\0"
+    "America/Puerto_Rico\0"
+    "America/Punta_Arenas\0"
+    "America/Rainy_River\0"
+    "America/Rankin_Inlet\0"
+    "America/Recife\0"
+    "America/Regina\0"
+    "America/Resolute\0"
+    "America/Rio_Branco\0"
+    "America/Santarem\0"
+    "America/Santiago\0"
+    "America/Santo_Domingo\0"
+    "America/Sao_Paulo\0"
+    "America/Scoresbysund\0"
+    "America/Sitka\0"
+    "America/St_Barthelemy\0"
+    "America/St_Johns\0"
+    "America/St_Kitts\0"
+    "America/St_Lucia\0"
+    "America/St_Thomas\0"
+    "America/St_Vincent\0"
+    "America/Swift_Current\0"
+    "America/Tegucigalpa\0"
+    "America/Thule\0"
+    "America/Thunder_Bay\0"
+    "America/Tijuana\0"
+    "America/Toronto\0"
+    "America/Tortola\0"
+    "America/Vancouver\0"
+    "America/Whitehorse\0"
+    "America/Winnipeg\0"
+    "America/Yakutat\0"
+    "America/Yellowknife\0"
+    "Antarctica/Casey\0"
+    "Antarctica/Davis\0"
+    "Antarctica/DumontDUrville\0"
+    "Antarctica/Macquarie\0"
+    "Antarctica/Mawson\0"
+    "Antarctica/McMurdo\0"
+    "Antarctica/Palmer\0"
+    "Antarctica/Rothera\0"
+    "Antarctica/Syowa\0"
+    "Antarctica/Troll\0"
+    "Antarctica/Vostok\0"
+    "Arctic/Longyearbyen\0"
+    "Asia/Aden\0"
+    "Asia/Almaty\0"
+    "Asia/Amman\0"
+    "Asia/Anadyr\0"
+    "Asia/Aqtau\0"
+    "Asia/Aqtobe\0"
+    "Asia/Ashgabat\0"
+    "Asia/Atyrau\0"
+    "Asia/Baghdad\0"
+    "Asia/Bahrain\0"
+    "Asia/Baku\0"
+    "Asia/Bangkok\0"
+    "Asia/Barnaul\0"
+    "Asia/Beirut\0"
+    "Asia/Bishkek\0"
+    "Asia/Brunei\0"
+    "Asia/Chita\0"
+    "Asia/Choibalsan\0"
+    "Asia/Colombo\0"
+    "Asia/Damascus\0"
+    "Asia/Dhaka\0"
+    "Asia/Dili\0"
+    "Asia/Dubai\0"
+    "Asia/Dushanbe\0"
+    "Asia/Famagusta\0"
+    "Asia/Gaza\0"
+    "Asia/Hebron\0"
+    "Asia/Ho_Chi_Minh\0"
+    "Asia/Hong_Kong\0"
+    "Asia/Hovd\0"
+    "Asia/Irkutsk\0"
+    "Asia/Jakarta\0"
+    "Asia/Jayapura\0"
+    "Asia/Jerusalem\0"
+    "Asia/Kabul\0"
+    "Asia/Kamchatka\0"
+    "Asia/Karachi\0"
+    "Asia/Kathmandu\0"
+    "Asia/Khandyga\0"
+    "Asia/Kolkata\0"
+    "Asia/Krasnoyarsk\0"
+    "Asia/Kuala_Lumpur\0"
+    "Asia/Kuching\0"
+    "Asia/Kuwait\0"
+    "Asia/Macau\0"
+    "Asia/Magadan\0"
+    "Asia/Makassar\0"
+    "Asia/Manila\0"
+    "Asia/Muscat\0"
+    "Asia/Nicosia\0"
+    "Asia/Novokuznetsk\0"
+    "Asia/Novosibirsk\0"
+    "Asia/Omsk\0"
+    "Asia/Oral\0"
+    "Asia/Phnom_Penh\0"
+    "Asia/Pontianak\0"
+    "Asia/Pyongyang\0"
+    "Asia/Qatar\0"
+    "Asia/Qyzylorda\0"
+    "Asia/Riyadh\0"
+    "Asia/Sakhalin\0"
+    "Asia/Samarkand\0"
+    "Asia/Seoul\0"
+    "Asia/Shanghai\0"
+    "Asia/Singapore\0"
+    "Asia/Srednekolymsk\0"
+    "Asia/Taipei\0"
+    "Asia/Tashkent\0"
+    "Asia/Tbilisi\0"
+    "Asia/Tehran\0"
+    "Asia/Thimphu\0"
+    "Asia/Tokyo\0"
+    "Asia/Tomsk\0"
+    "Asia/Ulaanbaatar\0"
+    "Asia/Urumqi\0"
+    "Asia/Ust-Nera\0"
+    "Asia/Vientiane\0"
+    "Asia/Vladivostok\0"
+    "Asia/Yakutsk\0"
+    "Asia/Yangon\0"
+    "Asia/Yekaterinburg\0"
+    "Asia/Yerevan\0"
+    "Atlantic/Azores\0"
+    "Atlantic/Bermuda\0"
+    "Atlantic/Canary\0"
+    "Atlantic/Cape_Verde\0"
+    "Atlantic/Faroe\0"
+    "Atlantic/Madeira\0"
+    "Atlantic/Reykjavik\0"
+    "Atlantic/South_Georgia\0"
+    "Atlantic/St_Helena\0"
+    "Atlantic/Stanley\0"
+    "Australia/Adelaide\0"
+    "Australia/Brisbane\0"
+    "Australia/Broken_Hill\0"
+    "Australia/Currie\0"
+    "Australia/Darwin\0"
+    "Australia/Eucla\0"
+    "Australia/Hobart\0"
+    "Australia/Lindeman\0"
+    "Australia/Lord_Howe\0"
+    "Australia/Melbourne\0"
+    "Australia/Perth\0"
+    "Australia/Sydney\0"
+    "Etc/GMT\0"
+    "Etc/GMT+0\0"
+    "Etc/GMT+1\0"
+    "Etc/GMT+10\0"
+    "Etc/GMT+11\0"
+    "Etc/GMT+12\0"
+    "Etc/GMT+2\0"
+    "Etc/GMT+3\0"
+    "Etc/GMT+4\0"
+    "Etc/GMT+5\0"
+    "Etc/GMT+6\0"
+    "Etc/GMT+7\0"
+    "Etc/GMT+8\0"
+    "Etc/GMT+9\0"
+    "Etc/GMT-0\0"
+    "Etc/GMT-1\0"
+    "Etc/GMT-10\0"
+    "Etc/GMT-11\0"
+    "Etc/GMT-12\0"
+    "Etc/GMT-13\0"
+    "Etc/GMT-14\0"
+    "Etc/GMT-2\0"
+    "Etc/GMT-3\0"
+    "Etc/GMT-4\0"
+    "Etc/GMT-5\0"
+    "Etc/GMT-6\0"
+    "Etc/GMT-7\0"
+    "Etc/GMT-8\0"
+    "Etc/GMT-9\0"
+    "Etc/GMT0\0"
+    "Etc/Greenwich\0"
+    "Etc/UCT\0"
+    "Etc/UTC\0"
+    "Etc/Universal\0"
+    "Etc/Zulu\0"
+    "Europe/Amsterdam\0"
+    "Europe/Andorra\0"
+    "Europe/Astrakhan\0"
+    "Europe/Athens\0"
+    "Europe/Belgrade\0"
+    "Europe/Berlin\0"
+    "Europe/Bratislava\0"
+    "Europe/Brussels\0"
+    "Europe/Bucharest\0"
+    "Europe/Budapest\0"
+    "Europe/Busingen\0"
+    "Europe/Chisinau\0"
+    "Europe/Copenhagen\0"
+    "Europe/Dublin\0"
+    "Europe/Gibraltar\0"
+    "Europe/Guernsey\0"
+    "Europe/Helsinki\0"
+    "Europe/Isle_of_Man\0"
+    "Europe/Istanbul\0"
+    "Europe/Jersey\0"
+    "Europe/Kaliningrad\0"
+    "Europe/Kiev\0"
+    "Europe/Kirov\0"
+    "Europe/Lisbon\0"
+    "Europe/Ljubljana\0"
+    "Europe/London\0"
+    "Europe/Luxembourg\0"
+    "Europe/Madrid\0"
+    "Europe/Malta\0"
+    "Europe/Mariehamn\0"
+    "Europe/Minsk\0"
+    "Europe/Monaco\0"
+    "Europe/Moscow\0"
+    "Europe/Oslo\0"
+    "Europe/Paris\0"
+    "Europe/Podgorica\0"
+    "Europe/Prague\0"
+    "Europe/Riga\0"
+    "Europe/Rome\0"
+    "Europe/Samara\0"
+    "Europe/San_Marino\0"
+    "Europe/Sarajevo\0"
+    "Europe/Saratov\0"
+    "Europe/Simferopol\0"
+    "Europe/Skopje\0"
+    "Europe/Sofia\0"
+    "Europe/Stockholm\0"
+    "Europe/Tallinn\0"
+    "Europe/Tirane\0"
+    "Europe/Ulyanovsk\0"
+    "Europe/Uzhgorod\0"
+    "Europe/Vaduz\0"
+    "Europe/Vatican\0"
+    "Europe/Vienna\0"
+    "Europe/Vilnius\0"
+    "Europe/Volgograd\0"
+    "Europe/Warsaw\0"
+    "Europe/Zagreb\0"
+    "Europe/Zaporozhye\0"
+    "Europe/Zurich\0"
+    "Indian/Antananarivo\0"
+    "Indian/Chagos\0"
+    "Indian/Christmas\0"
+    "Indian/Cocos\0"
+    "Indian/Comoro\0"
+    "Indian/Kerguelen\0"
+    "Indian/Mahe\0"
+    "Indian/Maldives\0"
+    "Indian/Mauritius\0"
+    "Indian/Mayotte\0"
+    "Indian/Reunion\0"
+    "Pacific/Apia\0"
+    "Pacific/Auckland\0"
+    "Pacific/Bougainville\0"
+    "Pacific/Chatham\0"
+    "Pacific/Chuuk\0"
+    "Pacific/Easter\0"
+    "Pacific/Efate\0"
+    "Pacific/Enderbury\0"
+    "Pacific/Fakaofo\0"
+    "Pacific/Fiji\0"
+    "Pacific/Funafuti\0"
+    "Pacific/Galapagos\0"
+    "Pacific/Gambier\0"
+    "Pacific/Guadalcanal\0"
+    "Pacific/Guam\0"
+    "Pacific/Honolulu\0"
+    "Pacific/Kiritimati\0"
+    "Pacific/Kosrae\0"
+    "Pacific/Kwajalein\0"
+    "Pacific/Majuro\0"
+    "Pacific/Marquesas\0"
+    "Pacific/Midway\0"
+    "Pacific/Nauru\0"
+    "Pacific/Niue\0"
+    "Pacific/Norfolk\0"
+    "Pacific/Noumea\0"
+    "Pacific/Pago_Pago\0"
+    "Pacific/Palau\0"
+    "Pacific/Pitcairn\0"
+    "Pacific/Pohnpei\0"
+    "Pacific/Port_Moresby\0"
+    "Pacific/Rarotonga\0"
+    "Pacific/Saipan\0"
+    "Pacific/Tahiti\0"
+    "Pacific/Tarawa\0"
+    "Pacific/Tongatapu\0"
+    "Pacific/Wake\0"
+    "Pacific/Wallis\0";
+
+// 99 distinct POSIX TZ strings, NUL separated
+static const char TZ_POSIX[] PROGMEM =
+    "<+00>0<+02>-2,M3.5.0/1,M10.5.0/3\0"
+    "<+01>-1\0"
+    "<+02>-2\0"
+    "<+0330>-3:30<+0430>,J79/24,J263/24\0"
+    "<+03>-3\0"
+    "<+0430>-4:30\0"
+    "<+04>-4\0"
+    "<+0530>-5:30\0"
+    "<+0545>-5:45\0"
+    "<+05>-5\0"
+    "<+0630>-6:30\0"
+    "<+06>-6\0"
+    "<+07>-7\0"
+    "<+0845>-8:45\0"
+    "<+08>-8\0"
+    "<+09>-9\0"
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0\0"
+    "<+10>-10\0"
+    "<+11>-11\0"
+    "<+11>-11<+12>,M10.1.0,M4.1.0/3\0"
+    "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45\0"
+    "<+12>-12\0"
+    "<+12>-12<+13>,M11.2.0,M1.2.3/99\0"
+    "<+13>-13\0"
+    "<+13>-13<+14>,M9.5.0/3,M4.1.0/4\0"
+    "<+14>-14\0"
+    "<-01>1\0"
+    "<-01>1<+00>,M3.5.0/0,M10.5.0/1\0"
+    "<-02>2\0"
+    "<-03>3\0"
+    "<-03>3<-02>,M3.2.0,M11.1.0\0"
+    "<-03>3<-02>,M3.5.0/-2,M10.5.0/-1\0"
+    "<-04>4\0"
+    "<-04>4<-03>,M10.1.0/0,M3.4.0/0\0"
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24\0"
+    "<-05>5\0"
+    "<-06>6\0"
+    "<-06>6<-05>,M9.1.6/22,M4.1.6/22\0"
+    "<-07>7\0"
+    "<-08>8\0"
+    "<-0930>9:30\0"
+    "<-09>9\0"
+    "<-10>10\0"
+    "<-11>11\0"
+    "<-12>12\0"
+    "ACST-9:30\0"
+    "ACST-9:30ACDT,M10.1.0,M4.1.0/3\0"
+    "AEST-10\0"
+    "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+    "AKST9AKDT,M3.2.0,M11.1.0\0"
+    "AST4\0"
+    "AST4ADT,M3.2.0,M11.1.0\0"
+    "AWST-8\0"
+    "CAT-2\0"
+    "CET-1\0"
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "CST-8\0"
+    "CST5CDT,M3.2.0/0,M11.1.0/1\0"
+    "CST6\0"
+    "CST6CDT,M3.2.0,M11.1.0\0"
+    "CST6CDT,M4.1.0,M10.5.0\0"
+    "ChST-10\0"
+    "EAT-3\0"
+    "EET-2\0"
+    "EET-2EEST,M3.4.4/48,M10.4.4/49\0"
+    "EET-2EEST,M3.5.0,M10.5.0/3\0"
+    "EET-2EEST,M3.5.0/0,M10.5.0/0\0"
+    "EET-2EEST,M3.5.0/3,M10.5.0/4\0"
+    "EET-2EEST,M3.5.4/24,M10.5.5/1\0"
+    "EET-2EEST,M3.5.5/0,M10.5.5/0\0"
+    "EST5\0"
+    "EST5EDT,M3.2.0,M11.1.0\0"
+    "GMT0\0"
+    "GMT0BST,M3.5.0/1,M10.5.0\0"
+    "HKT-8\0"
+    "HST10\0"
+    "HST10HDT,M3.2.0,M11.1.0\0"
+    "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+    "IST-2IDT,M3.4.4/26,M10.5.0\0"
+    "IST-5:30\0"
+    "JST-9\0"
+    "KST-9\0"
+    "MSK-3\0"
+    "MST7\0"
+    "MST7MDT,M3.2.0,M11.1.0\0"
+    "MST7MDT,M4.1.0,M10.5.0\0"
+    "NST3:30NDT,M3.2.0,M11.1.0\0"
+    "NZST-12NZDT,M9.5.0,M4.1.0/3\0"
+    "PKT-5\0"
+    "PST-8\0"
+    "PST8PDT,M3.2.0,M11.1.0\0"
+    "SAST-2\0"
+    "SST11\0"
+    "UTC0\0"
+    "WAT-1\0"
+    "WET0WEST,M3.5.0/1,M10.5.0\0"
+    "WIB-7\0"
+    "WIT-9\0"
+    "WITA-8\0";
+
+struct TzZone
+{
+  uint16_t name;
+  uint16_t posix;
+};
+
+// offsets into TZ_NAMES and TZ_POSIX, same order as TZ_NAMES
+static const TzZone TZ_ZONES[] PROGMEM = {
+    {0, 1196}, // Africa/Abidjan
+    {15, 1196}, // Africa/Accra
+    {28, 981}, // Africa/Addis_Ababa
+    {47, 856}, // Africa/Algiers
+    {62, 981}, // Africa/Asmara
+    {76, 1196}, // Africa/Bamako
+    {90, 1501}, // Africa/Bangui
+    {104, 1196}, // Africa/Banjul
+    {118, 1196}, // Africa/Bissau
+    {132, 850}, // Africa/Blantyre
+    {148, 1501}, // Africa/Brazzaville
+    {167, 850}, // Africa/Bujumbura
+    {184, 987}, // Africa/Cairo
+    {197, 33}, // Africa/Casablanca
+    {215, 862}, // Africa/Ceuta
+    {228, 1196}, // Africa/Conakry
+    {243, 1196}, // Africa/Dakar
+    {256, 981}, // Africa/Dar_es_Salaam
+    {277, 981}, // Africa/Djibouti
+    {293, 1501}, // Africa/Douala
+    {307, 33}, // Africa/El_Aaiun
+    {323, 1196}, // Africa/Freetown
+    {339, 850}, // Africa/Gaborone
+    {355, 850}, // Africa/Harare
+    {369, 1483}, // Africa/Johannesburg
+    {389, 981}, // Africa/Juba
+    {401, 981}, // Africa/Kampala
+    {416, 850}, // Africa/Khartoum
+    {432, 850}, // Africa/Kigali
+    {446, 1501}, // Africa/Kinshasa
+    {462, 1501}, // Africa/Lagos
+    {475, 1501}, // Africa/Libreville
+    {493, 1196}, // Africa/Lome
+    {505, 1501}, // Africa/Luanda
+    {519, 850}, // Africa/Lubumbashi
+    {537, 850}, // Africa/Lusaka
+    {551, 1501}, // Africa/Malabo
+    {565, 850}, // Africa/Maputo
+    {579, 1483}, // Africa/Maseru
+    {593, 1483}, // Africa/Mbabane
+    {608, 981}, // Africa/Mogadishu
+    {625, 1196}, // Africa/Monrovia
+    {641, 981}, // Africa/Nairobi
+    {656, 1501}, // Africa/Ndjamena
+    {672, 1501}, // Africa/Niamey
+    {686, 1196}, // Africa/Nouakchott
+    {704, 1196}, // Africa/Ouagadougou
+    {723, 1501}, // Africa/Porto-Novo
+    {741, 1196}, // Africa/Sao_Tome
+    {757, 987}, // Africa/Tripoli
+    {772, 856}, // Africa/Tunis
+    {785, 850}, // Africa/Windhoek
+    {801, 1238}, // America/Adak
+    {814, 790}, // America/Anchorage
+    {832, 815}, // America/Anguilla
+    {849, 815}, // America/Antigua
+    {865, 472}, // America/Araguaina
+    {883, 472}, // America/Argentina/Buenos_Aires
+    {914, 472}, // America/Argentina/Catamarca
+    {942, 472}, // America/Argentina/Cordoba
+    {968, 472}, // America/Argentina/Jujuy
+    {992, 472}, // America/Argentina/La_Rioja
+    {1019, 472}, // America/Argentina/Mendoza
+    {1045, 472}, // America/Argentina/Rio_Gallegos
+    {1076, 472}, // America/Argentina/Salta
+    {1100, 472}, // America/Argentina/San_Juan
+    {1127, 472}, // America/Argentina/San_Luis
+    {1154, 472}, // America/Argentina/Tucuman
+    {1180, 472}, // America/Argentina/Ushuaia
+    {1206, 815}, // America/Aruba
+    {1220, 546}, // America/Asuncion
+    {1237, 1168}, // America/Atikokan
+    {1254, 472}, // America/Bahia
+    {1268, 950}, // America/Bahia_Banderas
+    {1291, 815}, // America/Barbados
+    {1308, 472}, // America/Belem
+    {1322, 922}, // America/Belize
+    {1337, 815}, // America/Blanc-Sablon
+    {1358, 539}, // America/Boa_Vista
+    {1376, 609}, // America/Bogota
+    {1391, 1348}, // America/Boise
+    {1405, 1348}, // America/Cambridge_Bay
+    {1427, 539}, // America/Campo_Grande
+    {1448, 1168}, // America/Cancun
+    {1463, 539}, // America/Caracas
+    {1479, 472}, // America/Cayenne
+    {1495, 1168}, // America/Cayman
+    {1510, 927}, // America/Chicago
+    {1526, 1371}, // America/Chihuahua
+    {1544, 922}, // America/Costa_Rica
+    {1563, 1343}, // America/Creston
+    {1579, 539}, // America/Cuiaba
+    {1594, 815}, // America/Curacao
+    {1610, 1196}, // America/Danmarkshavn
+    {1631, 1343}, // America/Dawson
+    {1646, 1343}, // America/Dawson_Creek
+    {1667, 1348}, // America/Denver
+    {1682, 1173}, // America/Detroit
+    {1698, 815}, // America/Dominica
+    {1715, 1348}, // America/Edmonton
+    {1732, 609}, // America/Eirunepe
+    {1749, 922}, // America/El_Salvador
+    {1769, 1343}, // America/Fort_Nelson
+    {1789, 472}, // America/Fortaleza
+    {1807, 820}, // America/Glace_Bay
+    {1825, 506}, // America/Godthab
+    {1841, 820}, // America/Goose_Bay
+    {1859, 1173}, // America/Grand_Turk
+    {1878, 815}, // America/Grenada
+    {1894, 815}, // America/Guadeloupe
+    {1913, 922}, // America/Guatemala
+    {1931, 609}, // America/Guayaquil
+    {1949, 539}, // America/Guyana
+    {1964, 820}, // America/Halifax
+    {1980, 895}, // America/Havana
+    {1995, 1343}, // America/Hermosillo
+    {2014, 1173}, // America/Indiana/Indianapolis
+    {2043, 927}, // America/Indiana/Knox
+    {2064, 1173}, // America/Indiana/Marengo
+    {2088, 1173}, // America/Indiana/Petersburg
+    {2115, 927}, // America/Indiana/Tell_City
+    {2141, 1173}, // America/Indiana/Vevay
+    {2163, 1173}, // America/Indiana/Vincennes
+    {2189, 1173}, // America/Indiana/Winamac
+    {2213, 1348}, // America/Inuvik
+    {2228, 1173}, // America/Iqaluit
+    {2244, 1168}, // America/Jamaica
+    {2260, 790}, // America/Juneau
+    {2275, 1173}, // America/Kentucky/Louisville
+    {2303, 1173}, // America/Kentucky/Monticello
+    {2331, 815}, // America/Kralendijk
+    {2350, 539}, // America/La_Paz
+    {2365, 609}, // America/Lima
+    {2378, 1460}, // America/Los_Angeles
+    {2398, 815}, // America/Lower_Princes
+    {2420, 472}, // America/Maceio
+    {2435, 922}, // America/Managua
+    {2451, 539}, // America/Manaus
+    {2466, 815}, // America/Marigot
+    {2482, 815}, // America/Martinique
+    {2501, 927}, // America/Matamoros
+    {2519, 1371}, // America/Mazatlan
+    {2536, 927}, // America/Menominee
+    {2554, 950}, // America/Merida
+    {2569, 790}, // America/Metlakatla
+    {2588, 950}, // America/Mexico_City
+    {2608, 479}, // America/Miquelon
+    {2625, 820}, // America/Moncton
+    {2641, 950}, // America/Monterrey
+    {2659, 472}, // America/Montevideo
+    {2678, 1173}, // America/Montreal
+    {2695, 815}, // America/Montserrat
+    {2714, 1173}, // America/Nassau
+    {2729, 1173}, // America/New_York
+    {2746, 1173}, // America/Nipigon
+    {2762, 790}, // America/Nome
+    {2775, 465}, // America/Noronha
+    {2791, 927}, // America/North_Dakota/Beulah
+    {2819, 927}, // America/North_Dakota/Center
+    {2847, 927}, // America/North_Dakota/New_Salem
+    {2878, 506}, // America/Nuuk
+    {2891, 1348}, // America/Ojinaga
+    {2907, 1168}, // America/Panama
+    {2922, 1173}, // America/Pangnirtung
+    {2942, 472}, // America/Paramaribo
+    {2961, 1343}, // America/Phoenix
+    {2977, 1173}, // America/Port-au-Prince
+    {3000, 815}, // America/Port_of_Spain
+    {3022, 539}, // America/Porto_Velho
+    {3042, 815}, // America/Puerto_Rico
+    {3062, 472}, // America/Punta_Arenas
+    {3083, 927}, // America/Rainy_River
+    {3103, 927}, // America/Rankin_Inlet
+    {3124, 472}, // America/Recife
+    {3139, 922}, // America/Regina
+    {3154, 927}, // America/Resolute
+    {3171, 609}, // America/Rio_Branco
+    {3190, 472}, // America/Santarem
+    {3207, 577}, // America/Santiago
+    {3224, 815}, // America/Santo_Domingo
+    {3246, 472}, // America/Sao_Paulo
+    {3264, 434}, // America/Scoresbysund
+    {3285, 790}, // America/Sitka
+    {3299, 815}, // America/St_Barthelemy
+    {3321, 1394}, // America/St_Johns
+    {3338, 815}, // America/St_Kitts
+    {3355, 815}, // America/St_Lucia
+    {3372, 815}, // America/St_Thomas
+    {3390, 815}, // America/St_Vincent
+    {3409, 922}, // America/Swift_Current
+    {3431, 922}, // America/Tegucigalpa
+    {3451, 820}, // America/Thule
+    {3465, 1173}, // America/Thunder_Bay
+    {3485, 1460}, // America/Tijuana
+    {3501, 1173}, // America/Toronto
+    {3517, 815}, // America/Tortola
+    {3533, 1460}, // America/Vancouver
+    {3551, 1343}, // America/Whitehorse
+    {3570, 927}, // America/Winnipeg
+    {3587, 790}, // America/Yakutat
+    {3603, 1348}, // America/Yellowknife
+    {3623, 251}, // Antarctica/Casey
+    {3640, 168}, // Antarctica/Davis
+    {3657, 242}, // Antarctica/DumontDUrville
+    {3683, 761}, // Antarctica/Macquarie
+    {3704, 139}, // Antarctica/Mawson
+    {3722, 1420}, // Antarctica/McMurdo
+    {3741, 472}, // Antarctica/Palmer
+    {3759, 472}, // Antarctica/Rothera
+    {3778, 84}, // Antarctica/Syowa
+    {3795, 0}, // Antarctica/Troll
+    {3812, 160}, // Antarctica/Vostok
+    {3830, 862}, // Arctic/Longyearbyen
+    {3850, 84}, // Asia/Aden
+    {3860, 160}, // Asia/Almaty
+    {3872, 1109}, // Asia/Amman
+    {3883, 336}, // Asia/Anadyr
+    {3895, 139}, // Asia/Aqtau
+    {3906, 139}, // Asia/Aqtobe
+    {3918, 139}, // Asia/Ashgabat
+    {3932, 139}, // Asia/Atyrau
+    {3944, 84}, // Asia/Baghdad
+    {3957, 84}, // Asia/Bahrain
+    {3970, 105}, // Asia/Baku
+    {3980, 168}, // Asia/Bangkok
+    {3993, 168}, // Asia/Barnaul
+    {4006, 1051}, // Asia/Beirut
+    {4018, 160}, // Asia/Bishkek
+    {4031, 189}, // Asia/Brunei
+    {4043, 197}, // Asia/Chita
+    {4054, 189}, // Asia/Choibalsan
+    {4070, 113}, // Asia/Colombo
+    {4083, 1139}, // Asia/Damascus
+    {4097, 160}, // Asia/Dhaka
+    {4108, 197}, // Asia/Dili
+    {4118, 105}, // Asia/Dubai
+    {4129, 139}, // Asia/Dushanbe
+    {4143, 1080}, // Asia/Famagusta
+    {4158, 993}, // Asia/Gaza
+    {4168, 993}, // Asia/Hebron
+    {4180, 168}, // Asia/Ho_Chi_Minh
+    {4197, 1226}, // Asia/Hong_Kong
+    {4212, 168}, // Asia/Hovd
+    {4222, 189}, // Asia/Irkutsk
+    {4235, 1533}, // Asia/Jakarta
+    {4248, 1539}, // Asia/Jayapura
+    {4262, 1289}, // Asia/Jerusalem
+    {4277, 92}, // Asia/Kabul
+    {4288, 336}, // Asia/Kamchatka
+    {4303, 1448}, // Asia/Karachi
+    {4316, 126}, // Asia/Kathmandu
+    {4331, 197}, // Asia/Khandyga
+    {4345, 1316}, // Asia/Kolkata
+    {4358, 168}, // Asia/Krasnoyarsk
+    {4375, 189}, // Asia/Kuala_Lumpur
+    {4393, 189}, // Asia/Kuching
+    {4406, 84}, // Asia/Kuwait
+    {4418, 889}, // Asia/Macau
+    {4429, 251}, // Asia/Magadan
+    {4442, 1545}, // Asia/Makassar
+    {4456, 1454}, // Asia/Manila
+    {4468, 105}, // Asia/Muscat
+    {4480, 1080}, // Asia/Nicosia
+    {4493, 168}, // Asia/Novokuznetsk
+    {4511, 168}, // Asia/Novosibirsk
+    {4528, 160}, // Asia/Omsk
+    {4538, 139}, // Asia/Oral
+    {4548, 168}, // Asia/Phnom_Penh
+    {4564, 1533}, // Asia/Pontianak
+    {4579, 1331}, // Asia/Pyongyang
+    {4594, 84}, // Asia/Qatar
+    {4605, 139}, // Asia/Qyzylorda
+    {4620, 84}, // Asia/Riyadh
+    {4632, 251}, // Asia/Sakhalin
+    {4646, 139}, // Asia/Samarkand
+    {4661, 1331}, // Asia/Seoul
+    {4672, 889}, // Asia/Shanghai
+    {4686, 189}, // Asia/Singapore
+    {4701, 251}, // Asia/Srednekolymsk
+    {4720, 889}, // Asia/Taipei
+    {4732, 139}, // Asia/Tashkent
+    {4746, 105}, // Asia/Tbilisi
+    {4759, 49}, // Asia/Tehran
+    {4771, 160}, // Asia/Thimphu
+    {4784, 1325}, // Asia/Tokyo
+    {4795, 168}, // Asia/Tomsk
+    {4806, 189}, // Asia/Ulaanbaatar
+    {4823, 160}, // Asia/Urumqi
+    {4835, 242}, // Asia/Ust-Nera
+    {4849, 168}, // Asia/Vientiane
+    {4864, 242}, // Asia/Vladivostok
+    {4881, 197}, // Asia/Yakutsk
+    {4894, 147}, // Asia/Yangon
+    {4906, 139}, // Asia/Yekaterinburg
+    {4925, 105}, // Asia/Yerevan
+    {4938, 434}, // Atlantic/Azores
+    {4954, 820}, // Atlantic/Bermuda
+    {4971, 1507}, // Atlantic/Canary
+    {4987, 427}, // Atlantic/Cape_Verde
+    {5007, 1507}, // Atlantic/Faroe
+    {5022, 1507}, // Atlantic/Madeira
+    {5039, 1196}, // Atlantic/Reykjavik
+    {5058, 465}, // Atlantic/South_Georgia
+    {5081, 1196}, // Atlantic/St_Helena
+    {5100, 472}, // Atlantic/Stanley
+    {5117, 722}, // Australia/Adelaide
+    {5136, 753}, // Australia/Brisbane
+    {5155, 722}, // Australia/Broken_Hill
+    {5177, 761}, // Australia/Currie
+    {5194, 712}, // Australia/Darwin
+    {5211, 176}, // Australia/Eucla
+    {5227, 761}, // Australia/Hobart
+    {5244, 753}, // Australia/Lindeman
+    {5263, 205}, // Australia/Lord_Howe
+    {5283, 761}, // Australia/Melbourne
+    {5303, 843}, // Australia/Perth
+    {5319, 761}, // Australia/Sydney
+    {5336, 1196}, // Etc/GMT
+    {5344, 1196}, // Etc/GMT+0
+    {5354, 427}, // Etc/GMT+1
+    {5364, 688}, // Etc/GMT+10
+    {5375, 696}, // Etc/GMT+11
+    {5386, 704}, // Etc/GMT+12
+    {5397, 465}, // Etc/GMT+2
+    {5407, 472}, // Etc/GMT+3
+    {5417, 539}, // Etc/GMT+4
+    {5427, 609}, // Etc/GMT+5
+    {5437, 616}, // Etc/GMT+6
+    {5447, 655}, // Etc/GMT+7
+    {5457, 662}, // Etc/GMT+8
+    {5467, 681}, // Etc/GMT+9
+    {5477, 1196}, // Etc/GMT-0
+    {5487, 33}, // Etc/GMT-1
+    {5497, 242}, // Etc/GMT-10
+    {5508, 251}, // Etc/GMT-11
+    {5519, 336}, // Etc/GMT-12
+    {5530, 377}, // Etc/GMT-13
+    {5541, 418}, // Etc/GMT-14
+    {5552, 41}, // Etc/GMT-2
+    {5562, 84}, // Etc/GMT-3
+    {5572, 105}, // Etc/GMT-4
+    {5582, 139}, // Etc/GMT-5
+    {5592, 160}, // Etc/GMT-6
+    {5602, 168}, // Etc/GMT-7
+    {5612, 189}, // Etc/GMT-8
+    {5622, 197}, // Etc/GMT-9
+    {5632, 1196}, // Etc/GMT0
+    {5641, 1196}, // Etc/Greenwich
+    {5655, 1496}, // Etc/UCT
+    {5663, 1496}, // Etc/UTC
+    {5671, 1496}, // Etc/Universal
+    {5685, 1496}, // Etc/Zulu
+    {5694, 862}, // Europe/Amsterdam
+    {5711, 862}, // Europe/Andorra
+    {5726, 105}, // Europe/Astrakhan
+    {5743, 1080}, // Europe/Athens
+    {5757, 862}, // Europe/Belgrade
+    {5773, 862}, // Europe/Berlin
+    {5787, 862}, // Europe/Bratislava
+    {5805, 862}, // Europe/Brussels
+    {5821, 1080}, // Europe/Bucharest
+    {5838, 862}, // Europe/Budapest
+    {5854, 862}, // Europe/Busingen
+    {5870, 1024}, // Europe/Chisinau
+    {5886, 862}, // Europe/Copenhagen
+    {5904, 1262}, // Europe/Dublin
+    {5918, 862}, // Europe/Gibraltar
+    {5935, 1201}, // Europe/Guernsey
+    {5951, 1080}, // Europe/Helsinki
+    {5967, 1201}, // Europe/Isle_of_Man
+    {5986, 84}, // Europe/Istanbul
+    {6002, 1201}, // Europe/Jersey
+    {6016, 987}, // Europe/Kaliningrad
+    {6035, 1080}, // Europe/Kiev
+    {6047, 84}, // Europe/Kirov
+    {6060, 1507}, // Europe/Lisbon
+    {6074, 862}, // Europe/Ljubljana
+    {6091, 1201}, // Europe/London
+    {6105, 862}, // Europe/Luxembourg
+    {6123, 862}, // Europe/Madrid
+    {6137, 862}, // Europe/Malta
+    {6150, 1080}, // Europe/Mariehamn
+    {6167, 84}, // Europe/Minsk
+    {6180, 862}, // Europe/Monaco
+    {6194, 1337}, // Europe/Moscow
+    {6208, 862}, // Europe/Oslo
+    {6220, 862}, // Europe/Paris
+    {6233, 862}, // Europe/Podgorica
+    {6250, 862}, // Europe/Prague
+    {6264, 1080}, // Europe/Riga
+    {6276, 862}, // Europe/Rome
+    {6288, 105}, // Europe/Samara
+    {6302, 862}, // Europe/San_Marino
+    {6320, 862}, // Europe/Sarajevo
+    {6336, 105}, // Europe/Saratov
+    {6351, 1337}, // Europe/Simferopol
+    {6369, 862}, // Europe/Skopje
+    {6383, 1080}, // Europe/Sofia
+    {6396, 862}, // Europe/Stockholm
+    {6413, 1080}, // Europe/Tallinn
+    {6428, 862}, // Europe/Tirane
+    {6442, 105}, // Europe/Ulyanovsk
+    {6459, 1080}, // Europe/Uzhgorod
+    {6475, 862}, // Europe/Vaduz
+    {6488, 862}, // Europe/Vatican
+    {6503, 862}, // Europe/Vienna
+    {6517, 1080}, // Europe/Vilnius
+    {6532, 84}, // Europe/Volgograd
+    {6549, 862}, // Europe/Warsaw
+    {6563, 862}, // Europe/Zagreb
+    {6577, 1080}, // Europe/Zaporozhye
+    {6595, 862}, // Europe/Zurich
+    {6609, 981}, // Indian/Antananarivo
+    {6629, 160}, // Indian/Chagos
+    {6643, 168}, // Indian/Christmas
+    {6660, 147}, // Indian/Cocos
+    {6673, 981}, // Indian/Comoro
+    {6687, 139}, // Indian/Kerguelen
+    {6704, 105}, // Indian/Mahe
+    {6716, 139}, // Indian/Maldives
+    {6732, 105}, // Indian/Mauritius
+    {6749, 981}, // Indian/Mayotte
+    {6764, 105}, // Indian/Reunion
+    {6779, 386}, // Pacific/Apia
+    {6792, 1420}, // Pacific/Auckland
+    {6809, 251}, // Pacific/Bougainville
+    {6830, 291}, // Pacific/Chatham
+    {6846, 242}, // Pacific/Chuuk
+    {6860, 623}, // Pacific/Easter
+    {6875, 251}, // Pacific/Efate
+    {6889, 377}, // Pacific/Enderbury
+    {6907, 377}, // Pacific/Fakaofo
+    {6923, 345}, // Pacific/Fiji
+    {6936, 336}, // Pacific/Funafuti
+    {6953, 616}, // Pacific/Galapagos
+    {6971, 681}, // Pacific/Gambier
+    {6987, 251}, // Pacific/Guadalcanal
+    {7007, 973}, // Pacific/Guam
+    {7020, 1232}, // Pacific/Honolulu
+    {7037, 418}, // Pacific/Kiritimati
+    {7056, 251}, // Pacific/Kosrae
+    {7071, 336}, // Pacific/Kwajalein
+    {7089, 336}, // Pacific/Majuro
+    {7104, 669}, // Pacific/Marquesas
+    {7122, 1490}, // Pacific/Midway
+    {7137, 336}, // Pacific/Nauru
+    {7151, 696}, // Pacific/Niue
+    {7164, 260}, // Pacific/Norfolk
+    {7180, 251}, // Pacific/Noumea
+    {7195, 1490}, // Pacific/Pago_Pago
+    {7213, 197}, // Pacific/Palau
+    {7227, 662}, // Pacific/Pitcairn
+    {7244, 251}, // Pacific/Pohnpei
+    {7260, 242}, // Pacific/Port_Moresby
+    {7281, 688}, // Pacific/Rarotonga
+    {7299, 973}, // Pacific/Saipan
+    {7314, 688}, // Pacific/Tahiti
+    {7329, 336}, // Pacific/Tarawa
+    {7344, 377}, // Pacific/Tongatapu
+    {7362, 336}, // Pacific/Wake
+    {7375, 336}, // Pacific/Wallis
+};
+
+// Returns the POSIX TZ string of a zone as a PROGMEM pointer, nullptr if unknown
+PGM_P findTzInfo(const char *timezone)
+{
+  int16_t low = 0;
+  int16_t high = sizeof(TZ_ZONES) / sizeof(TzZone) - 1;
+  while (low <= high)
+  {
+    int16_t middle = (low + high) / 2;
+    int order = strcmp_P(timezone, TZ_NAMES + pgm_read_word(&TZ_ZONES[middle].name));
+    if (order == 0)
+    {
+      return TZ_POSIX + pgm_read_word(&TZ_ZONES[middle].posix);
+    }
+    if (order < 0)
+    {
+      high = middle - 1;
+    }
+    else
+    {
+      low = middle + 1;
+    }
+  }
+  return nullptr;
+}
+
+String getTzInfo(const String &timezone) {
+  PGM_P posix = findTzInfo(timezone.c_str());
+  return posix != nullptr ? String(FPSTR(posix)) : String(F("UTC0"));
 }
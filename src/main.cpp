@@ -26,7 +26,7 @@
 #include <Arduino.h>
 #include "time.h"
 #include <SPI.h>
-#ifdef ESP32
+#if defined(ESP32) || defined(NATIVE)
 #include <WiFi.h>
 #endif
 #ifdef ESP8266
@@ -34,12 +34,32 @@
 #endif
 
 #include "SunMoonCalc.h"
-#include <JsonListener.h>
-#include <OpenWeatherMapCurrent.h>
-#include <OpenWeatherMapForecast.h>
+#include <WeatherFetcher.h>
+#include <WeatherCache.h>
+#include <WifiCache.h>
+#ifdef BATTERY_MODE
+#if defined(USE_NETWORK_TASK) || !(defined(ESP8266) || defined(ESP32))
+#error "BATTERY_MODE needs an ESP8266 or ESP32 without NETWORK_TASK"
+#endif
+// every wake renders once, downloads when due and goes back to deep sleep
+#include <DutyCycle.h>
+#endif
+#ifdef ESP8266
+#include <coredecls.h>
+#endif
+#ifdef ESP32
+#include <esp_sleep.h>
+#include <esp_sntp.h>
+#endif
+#if defined(ESP32) && defined(NETWORK_TASK)
+// WiFi, NTP and downloads run in a task on core 0, drawing stays on core 1
+#define USE_NETWORK_TASK
+#include <SnapshotExchange.h>
+#endif
 #include <Astronomy.h>
 #include <MiniGrafx.h>
-#include <Carousel.h>
+#include <Canvas.h>
+#include <Widgets.h>
 
 #ifdef DISPLAY_ST7789
 #include <ST7789_SPI.h>
@@ -50,7 +70,7 @@
 #define Display ILI9341_SPI
 #endif
 #include "ArialRounded.h"
-#include "moonphases.h"
+#include "generated/moonphases.h"
 #include "weathericons.h"
 
 #include "main.h"
@@ -60,25 +80,39 @@
 #define MINI_YELLOW 2
 #define MINI_BLUE 3
 
-#define MAX_FORECASTS 12
-
 // defines the colors usable in the paletted 16 color frame buffer
 uint16_t palette[] = {ILI9341_BLACK,  // 0
                       ILI9341_WHITE,  // 1
                       ILI9341_YELLOW, // 2
                       0x7E3C};        // 3
 
+#ifdef BAND_HEIGHT
+#ifndef DISPLAY_ST7789
+#error "BAND_HEIGHT needs the ST7789 driver"
+#endif
+// 16 bit color, drawn band by band. A 240x24 band takes 11.5 KB.
+int BITS_PER_PIXEL = 16;
+#else
 // Limited to 4 colors due to memory constraints
 int BITS_PER_PIXEL = 2; // 2^2 =  4 colors
+#endif
 
 #ifdef ESP8266
 ADC_MODE(ADC_VCC);
 #endif
 
 Display tft = Display(TFT_CS, TFT_DC, TFT_RST);
-MiniGrafx gfx = MiniGrafx(&tft, BITS_PER_PIXEL, palette);
-Carousel carousel(&gfx, 0, 0, tft.width(), 100);
-const int itemsOnCarousel = tft.width() > 300 ? 4 : 3;
+#ifdef BAND_HEIGHT
+// one band as wide as the display in TFT_ROTATION
+MiniGrafx miniGrafx = MiniGrafx(&tft, BITS_PER_PIXEL, palette, TFT_ROTATION & 1 ? ST7789_TFTHEIGHT : ST7789_TFTWIDTH,
+                                BAND_HEIGHT);
+Canvas gfx(&miniGrafx, &tft, palette, sizeof(palette) / sizeof(palette[0]));
+#else
+MiniGrafx miniGrafx = MiniGrafx(&tft, BITS_PER_PIXEL, palette);
+// all drawing goes through the canvas, it tracks what has to be flushed
+Canvas gfx(&miniGrafx);
+#endif
+int itemsOnCarousel = 3;
 
 #if defined(TOUCH_CS) && defined(TOUCH_IRQ)
 #define TOUCH_ENABLED
@@ -90,17 +124,57 @@ void calibrationCallback(int16_t x, int16_t y);
 CalibrationCallback calibration = &calibrationCallback;
 #endif
 
-OpenWeatherMapCurrentData currentWeather;
-OpenWeatherMapForecastData forecasts[MAX_FORECASTS];
+WeatherFetcher weatherFetcher;
+// model the screens show, replaced as a whole when a refresh completes
+const WeatherModel *weather = weatherFetcher.getModel();
+// last model saved to flash, shown after boot until fresh data arrived
+WeatherCache weatherCache(SPIFFS);
+WeatherModel *cachedWeather = nullptr;
+uint32_t cachedWeatherTime = 0;
+// false while the cached model stays on screen during boot
+boolean showProgress = true;
+// access point and lease of the last connection
+WifiCache wifiCache(SPIFFS);
+#ifdef BATTERY_MODE
+DutyCycle dutyCycle;
+#endif
+
+#ifdef USE_NETWORK_TASK
+struct ProgressSnapshot
+{
+  uint8_t percentage;
+  char text[64];
+};
+
+TaskHandle_t networkTaskHandle = nullptr;
+// the network task publishes, loop() picks up the latest value each frame
+SnapshotExchange<WeatherModel> weatherExchange;
+SnapshotExchange<ProgressSnapshot> progressExchange;
+#endif
 
 Astronomy::MoonData moonData;
 // SunMoonCalc::Moon moonData;
+const float LUNAR_MONTH = 29.53;
+// index into moonphases, the moon widget only redraws when it changes
+uint8_t moonFrame = 0;
 
 int frameCount = 3;
-FrameCallback frames[] = {drawForecast1, drawForecast2, drawForecast3};
+CarouselFrame frames[] = {drawForecast1, drawForecast2, drawForecast3};
 
 // how many different screens do we have?
 int screenCount = 5;
+Screen *screens[5];
+Screen *progressScreen;
+// screen whose widgets are currently in the frame buffer
+Screen *shownScreen = nullptr;
+
+// bumped whenever new weather data arrived, widgets showing it redraw then
+uint32_t weatherVersion = 0;
+uint8_t progressPercentage = 0;
+char progressText[64] = "";
+uint32_t progressVersion = 0;
+// upper bound for the frame rate, mostly relevant for carousel transitions
+const long FRAME_MILLIS = 1000 / 30;
 long lastDownloadUpdate = 0;
 long lastScreenChange = 0;
 
@@ -108,10 +182,14 @@ uint16_t screen = 0;
 long timerPress;
 bool canBtnPress;
 
-void connectWifi()
+// Gives up after timeout ms unless that is 0
+boolean connectWifi(unsigned long timeout = 0)
 {
   if (WiFi.status() == WL_CONNECTED)
-    return;
+    return true;
+
+  if (connectWifiFast())
+    return true;
 
   // Manual Wifi
   Serial.printf("Connecting to WiFi %s/%s", WIFI_SSID.c_str(), WIFI_PASS.c_str());
@@ -120,37 +198,111 @@ void connectWifi()
   WiFi.hostname(CONFIG_WIFI_HOSTNAME);
   WiFi.begin(WIFI_SSID.c_str(), WIFI_PASS.c_str());
   int i = 0;
+  unsigned long start = millis();
   while (WiFi.status() != WL_CONNECTED)
   {
+    if (timeout > 0 && millis() - start > timeout)
+    {
+      Serial.println(" timed out.");
+      return false;
+    }
     delay(500);
     if (i > 80)
       i = 0;
-    drawProgress(i, "Connecting to WiFi '" + String(WIFI_SSID.c_str()) + "'");
+    Text<64> text;
+    text.printf("Connecting to WiFi '%s'", WIFI_SSID.c_str());
+    drawProgress(i, text.c_str());
     i += 10;
     Serial.print(".");
   }
-  drawProgress(100, "Connected to WiFi '" + String(WIFI_SSID.c_str()) + "'");
+  Text<64> text;
+  text.printf("Connected to WiFi '%s'", WIFI_SSID.c_str());
+  drawProgress(100, text.c_str());
   Serial.println("connected.");
   Serial.printf("Connected, IP address: %s/%s\n", WiFi.localIP().toString().c_str(), WiFi.subnetMask().toString().c_str()); // Get ip and subnet mask
   Serial.printf("Connected, MAC address: %s\n", WiFi.macAddress().c_str());                                                 // Get the local mac address
+  wifiCache.save(WIFI_SSID, WIFI_PASS);
+  return true;
 }
 
-void initTime()
+// Joins the access point of the last connection on its channel and reuses
+// the lease, no scan and no DHCP. False if nothing is cached or it failed.
+boolean connectWifiFast()
 {
-  time_t now;
+  WifiConnection cached;
+  if (!wifiCache.load(WIFI_SSID, WIFI_PASS, &cached))
+  {
+    return false;
+  }
+  Serial.printf("Reconnecting to WiFi %s on channel %d", WIFI_SSID.c_str(), cached.channel);
+  unsigned long start = millis();
+  WiFi.mode(WIFI_STA);
+  WiFi.hostname(CONFIG_WIFI_HOSTNAME);
+  WiFi.config(IPAddress(cached.ip), IPAddress(cached.gateway), IPAddress(cached.subnet), IPAddress(cached.dns));
+  WiFi.begin(WIFI_SSID.c_str(), WIFI_PASS.c_str(), cached.channel, cached.bssid);
+  while (WiFi.status() != WL_CONNECTED)
+  {
+    if (millis() - start > WIFI_FAST_CONNECT_TIMEOUT)
+    {
+      Serial.println(" failed.");
+      // the access point moved or the lease is gone, back to scan and DHCP
+      wifiCache.clear();
+      WiFi.config(IPAddress(), IPAddress(), IPAddress());
+      return false;
+    }
+    delay(10);
+  }
+  Serial.printf(" connected after %lu ms, IP address: %s\n", millis() - start, WiFi.localIP().toString().c_str());
+  return true;
+}
 
-  gfx.fillBuffer(MINI_BLACK);
-  gfx.setFont(ArialRoundedMTBold_14);
+// Set by SNTP only. A clock restored after deep sleep is valid already, but
+// has drifted with the RTC timer.
+volatile boolean timeSynchronized = false;
+
+#ifdef ESP8266
+// the core delays the first request by up to a minute, with the radio on
+uint32_t sntp_startup_delay_MS_rfc_not_less_than_60000()
+{
+  return 0;
+}
+
+void onTimeSynchronized()
+{
+  timeSynchronized = true;
+}
+#endif
+#ifdef ESP32
+void onTimeSynchronized(struct timeval *)
+{
+  timeSynchronized = true;
+}
+#endif
+
+// Waits up to NTP_SYNC_TIMEOUT for a time server, returns whether one answered
+boolean initTime()
+{
+  time_t now;
 
   Serial.printf("Configuring time for timezone %s\n", TIMEZONE.c_str());
+  timeSynchronized = false;
 #ifdef ESP8266
+  settimeofday_cb(onTimeSynchronized);
   configTime(TIMEZONE.c_str(), NTP_SERVERS);
 #endif
 #ifdef ESP32
+  sntp_set_time_sync_notification_cb(onTimeSynchronized);
   configTime(GMT_OFFSET_SEC, DAYLIGHT_OFFSET_SEC, NTP_SERVERS);
 #endif
+#ifdef NATIVE
+  // the host clock is already set, only the zone is missing
+  setenv("TZ", TIMEZONE.c_str(), 1);
+  tzset();
+  timeSynchronized = true;
+#endif
+  unsigned long start = millis();
   int i = 1;
-  while ((now = time(nullptr)) < NTP_MIN_VALID_EPOCH)
+  while (!timeSynchronized && millis() - start < NTP_SYNC_TIMEOUT)
   {
     drawProgress(i * 10, "Updating time...");
     Serial.print(".");
@@ -158,17 +310,315 @@ void initTime()
     yield();
     i++;
   }
-  drawProgress(100, "Time synchronized");
-  Serial.println();
+  drawProgress(100, timeSynchronized ? "Time synchronized" : "No time server");
+  Serial.println(timeSynchronized ? "" : " no time server answered");
+  now = time(nullptr);
 
   printf("Local time: %s", asctime(localtime(&now))); // print formated local time, same as ctime(&now)
   printf("UTC time:   %s", asctime(gmtime(&now)));    // print formated GMT/UTC time
+  return timeSynchronized;
+}
+
+#if defined(BENCHMARK_FLUSH) && defined(DISPLAY_ST7789)
+// Times full frame commits with the driver's palette lookup table off and on,
+// then commits of a clock digit sized window, where the address window and
+// the pin toggling around it weigh most
+void benchmarkFlush()
+{
+  const uint8_t rounds = 20;
+  for (uint8_t lut = 0; lut < 2; lut++)
+  {
+    tft.setPaletteLutEnabled(lut);
+    uint32_t start = micros();
+    for (uint8_t i = 0; i < rounds; i++)
+    {
+      miniGrafx.commit();
+    }
+    Serial.printf("Flush benchmark: palette LUT %s, %lu us per commit\n", lut ? "on" : "off", (unsigned long)(micros() - start) / rounds);
+  }
+  uint32_t start = micros();
+  for (uint8_t i = 0; i < rounds; i++)
+  {
+    gfx.addDamage(0, 0, 16, 24);
+    gfx.commit();
+  }
+  Serial.printf("Flush benchmark: 16x24 window, %lu us per commit\n", (unsigned long)(micros() - start) / rounds);
+}
+#endif
+
+#ifdef BENCHMARK_ICONS
+// Unpacks a run length encoded icon into the raw format MiniGrafx reads
+char *unpackIcon(const char *rleBmp)
+{
+  uint16_t width = pgm_read_byte(rleBmp + 2) << 8 | pgm_read_byte(rleBmp + 3);
+  uint16_t height = pgm_read_byte(rleBmp + 4) << 8 | pgm_read_byte(rleBmp + 5);
+  // rows are padded to whole bytes, four pixels each
+  uint16_t rowWidth = (width + 3) & ~3;
+  char *raw = (char *)calloc(6 + rowWidth * height / 4, 1);
+  for (uint8_t i = 1; i < 6; i++)
+  {
+    raw[i] = pgm_read_byte(rleBmp + i);
+  }
+  raw[0] = 1;
+
+  const char *data = rleBmp + 6;
+  uint32_t pixel = 0;
+  while (pixel < (uint32_t)width * height)
+  {
+    uint8_t run = pgm_read_byte(data++);
+    uint16_t length = (run & 0x3F) + 1;
+    if (length == 64)
+    {
+      length += pgm_read_byte(data++);
+    }
+    for (; length > 0; length--, pixel++)
+    {
+      uint32_t offset = pixel / width * rowWidth + pixel % width;
+      raw[6 + offset / 4] |= (run >> 6) << ((3 - offset % 4) * 2);
+    }
+  }
+  return raw;
+}
+
+// Times drawing every icon from its run length encoded form and from the raw
+// form, unpacked to RAM, that MiniGrafx draws pixel by pixel
+void benchmarkIcons()
+{
+  const uint8_t rounds = 5;
+  gfx.setTransparentColor(MINI_BLACK);
+  for (uint8_t mini = 0; mini < 2; mini++)
+  {
+    uint32_t rleMicros = 0;
+    uint32_t rawMicros = 0;
+    for (uint8_t icon = 0; icon < WEATHER_ICON_COUNT; icon++)
+    {
+      const char *rleBmp = mini ? getMiniMeteoconIconFromProgmem((WeatherIcon)icon) : getMeteoconIconFromProgmem((WeatherIcon)icon);
+      char *raw = unpackIcon(rleBmp);
+      uint32_t start = micros();
+      for (uint8_t i = 0; i < rounds; i++)
+      {
+        gfx.drawPalettedBitmapFromPgm(0, 0, rleBmp);
+      }
+      rleMicros += micros() - start;
+      start = micros();
+      for (uint8_t i = 0; i < rounds; i++)
+      {
+        gfx.drawPalettedBitmapFromPgm(0, 0, raw);
+      }
+      rawMicros += micros() - start;
+      free(raw);
+    }
+    Serial.printf("Icon benchmark: %s icons, RLE %lu us, raw %lu us per draw\n", mini ? "mini" : "large",
+                  (unsigned long)rleMicros / (rounds * WEATHER_ICON_COUNT), (unsigned long)rawMicros / (rounds * WEATHER_ICON_COUNT));
+  }
+  gfx.fillBuffer(MINI_BLACK);
+}
+#endif
+
+uint32_t getWeatherVersion()
+{
+  return weatherVersion;
+}
+
+uint32_t getClockVersion()
+{
+  time_t now = time(nullptr);
+  if (IS_STYLE_HHMM)
+  {
+    now /= 60;
+  }
+  return (uint32_t)now << 1 | IS_STYLE_12HR;
+}
+
+uint32_t getDateVersion()
+{
+  time_t now = time(nullptr);
+  if (now < NTP_MIN_VALID_EPOCH)
+  {
+    return 0;
+  }
+  struct tm *timeinfo = localtime(&now);
+  return timeinfo->tm_year * 366 + timeinfo->tm_yday + 1;
+}
+
+uint32_t getMeridiemVersion()
+{
+  time_t now = time(nullptr);
+  return IS_STYLE_12HR << 1 | (now >= NTP_MIN_VALID_EPOCH && localtime(&now)->tm_hour >= 12);
+}
+
+uint32_t getWifiVersion()
+{
+  return getWifiQuality();
+}
+
+uint32_t getUptimeVersion()
+{
+  return millis() / (1000 * 60);
+}
+
+uint32_t getHeapVersion()
+{
+  return ESP.getFreeHeap() / 1024;
+}
+
+uint32_t getRssiVersion()
+{
+  return WiFi.RSSI();
+}
+
+// Days since the last new moon. calculateMoonData() only reports the
+// illumination, the phase tells the waxing from the waning half.
+float getMoonAge()
+{
+  float age = acos(1 - 2 * moonData.illumination) / (2 * PI) * LUNAR_MONTH;
+  return moonData.phase <= 4 ? age : LUNAR_MONTH - age;
+}
+
+// moonphase_L0 is one frame past the new moon, the last frame is the new moon
+uint8_t getMoonFrame(float age)
+{
+  uint8_t frame = (uint8_t)(age / LUNAR_MONTH * moonphases_Count + 0.5);
+  return (frame + moonphases_Count - 1) % moonphases_Count;
+}
+
+const char *getUnit(const char *metric, const char *imperial)
+{
+  return IS_METRIC ? metric : imperial;
+}
+
+// Appends a fixed point model value with decimals digits after the point,
+// rounded or padded to shown digits
+void printFixed(TextBuffer &text, int32_t value, uint8_t decimals, uint8_t shown)
+{
+  for (; decimals > shown; decimals--)
+  {
+    value = (value + (value < 0 ? -5 : 5)) / 10;
+  }
+  for (; decimals < shown; decimals++)
+  {
+    value *= 10;
+  }
+  uint32_t magnitude = abs(value);
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < shown; i++)
+  {
+    scale *= 10;
+  }
+  if (shown == 0)
+  {
+    text.printf("%s%u", value < 0 ? "-" : "", magnitude);
+  }
+  else
+  {
+    text.printf("%s%u.%0*u", value < 0 ? "-" : "", magnitude / scale, shown, magnitude % scale);
+  }
+}
+
+// Builds the widgets of all screens, needs the display to be rotated already
+void initScreens()
+{
+  uint16_t width = tft.width();
+  uint16_t height = tft.height();
+  itemsOnCarousel = width > 300 ? 4 : 3;
+
+  static Widget *progressWidgets[] = {
+      new Icon((width - ThingPulseLogo_Width) / 2, 5, ThingPulseLogo_Width, ThingPulseLogo_Height, MINI_BLACK,
+               []() { return ThingPulseLogo; }, nullptr),
+      new Label(0, 90, width, 17, ArialRoundedMTBold_14, MINI_WHITE, TEXT_ALIGN_CENTER,
+                [](TextBuffer &text) { text.print("https://thingpulse.com"); }, nullptr),
+      new Label(0, 146, width, 17, ArialRoundedMTBold_14, MINI_YELLOW, TEXT_ALIGN_CENTER,
+                [](TextBuffer &text) { text.print(progressText); }, []() { return progressVersion; }),
+      new ProgressBar(10, 168, width - 2 * 10, 15, MINI_WHITE, MINI_BLUE, []() { return progressPercentage; })};
+  progressScreen = new Screen(progressWidgets, sizeof(progressWidgets) / sizeof(Widget *));
+
+  CarouselWidget *forecastCarousel = new CarouselWidget(0, 150, width, 95, frames, frameCount);
+#if defined(DISPLAY_ST7789) && !defined(BAND_HEIGHT)
+  // scrolling needs the next frame kept in the frame buffer
+  forecastCarousel->setHardwareScroll(&tft);
+#endif
+  static Widget *currentWeatherWidgets[] = {
+      // date, time and AM/PM keep clear of the WiFi quality on the right
+      new Label(36, 6, width - 2 * 36, 14, ArialRoundedMTBold_14, MINI_WHITE, TEXT_ALIGN_CENTER, printDate,
+                getDateVersion),
+      new DigitLabel(36, 20, width - 2 * 36, 35, ArialRoundedMTBold_36, MINI_WHITE, printClock, getClockVersion),
+      new Label(195, 27, 30, 13, ArialMT_Plain_10, MINI_BLUE, TEXT_ALIGN_LEFT, printMeridiem, getMeridiemVersion),
+      new FunctionWidget(width - 36, 0, 36, 22, drawWifiQuality, getWifiVersion),
+      new FunctionWidget(0, 55, width, 95, drawCurrentWeather, getWeatherVersion),
+      forecastCarousel,
+      new FunctionWidget(0, 245, width, height - 245, drawAstronomy, getWeatherVersion),
+      new Icon((width - moonphases_Width) / 2, 270, moonphases_Width, moonphases_Height, MINI_BLACK,
+               []() { return (const char *)pgm_read_ptr(&moonphases[moonFrame]); },
+               []() { return (uint32_t)moonFrame; })};
+  screens[0] = new Screen(currentWeatherWidgets, sizeof(currentWeatherWidgets) / sizeof(Widget *));
+
+  // label and value columns as drawLabelValue() used to place them
+  const uint8_t labelX = 15;
+  const uint16_t valueOffset = width / 2 - labelX;
+#define LABEL_VALUE(line, label, value, version)                                                      \
+  new ValuePair(labelX, 30 + (line) * 15, width - labelX, 17, valueOffset, ArialRoundedMTBold_14, \
+                MINI_YELLOW, MINI_WHITE, label, value, version)
+
+  static Widget *currentWeatherDetailWidgets[] = {
+      new Label(0, 2, width, 17, ArialRoundedMTBold_14, MINI_WHITE, TEXT_ALIGN_CENTER,
+                [](TextBuffer &text) { text.print("Current Conditions"); }, nullptr),
+      LABEL_VALUE(0, "Temperature:", [](TextBuffer &text) { printFixed(text, weather->current.temp, 1, 1); text.print(getUnit("°C", "°F")); }, getWeatherVersion),
+      LABEL_VALUE(1, "Wind Speed:", [](TextBuffer &text) { printFixed(text, weather->current.windSpeed, 1, 1); text.print(getUnit("m/s", "mph")); }, getWeatherVersion),
+      LABEL_VALUE(2, "Wind Dir:", [](TextBuffer &text) { printFixed(text, weather->current.windDeg, 0, 1); text.print("°"); }, getWeatherVersion),
+      LABEL_VALUE(3, "Humidity:", [](TextBuffer &text) { text.printf("%u%%", weather->current.humidity); }, getWeatherVersion),
+      LABEL_VALUE(4, "Pressure:", [](TextBuffer &text) { text.printf("%uhPa", weather->current.pressure); }, getWeatherVersion),
+      LABEL_VALUE(5, "Clouds:", [](TextBuffer &text) { text.printf("%u%%", weather->current.clouds); }, getWeatherVersion),
+      LABEL_VALUE(6, "Visibility:", [](TextBuffer &text) { text.printf("%um", weather->current.visibility); }, getWeatherVersion)};
+  screens[1] = new Screen(currentWeatherDetailWidgets, sizeof(currentWeatherDetailWidgets) / sizeof(Widget *));
+
+  static Widget *forecastTableWidgets[] = {
+      new FunctionWidget(0, 0, width, height, []() { drawForecastTable(0); }, getWeatherVersion)};
+  screens[2] = new Screen(forecastTableWidgets, 1);
+  static Widget *forecastTableWidgets2[] = {
+      new FunctionWidget(0, 0, width, height, []() { drawForecastTable(4); }, getWeatherVersion)};
+  screens[3] = new Screen(forecastTableWidgets2, 1);
+
+  static Widget *aboutWidgets[] = {
+      new Icon((width - ThingPulseLogo_Width) / 2, 5, ThingPulseLogo_Width, ThingPulseLogo_Height, MINI_BLACK,
+               []() { return ThingPulseLogo; }, nullptr),
+      new Label(0, 90, width, 17, ArialRoundedMTBold_14, MINI_WHITE, TEXT_ALIGN_CENTER,
+                [](TextBuffer &text) { text.print("https://thingpulse.com"); }, nullptr),
+      LABEL_VALUE(7, "Heap Mem:", [](TextBuffer &text) { text.printf("%ukb", (unsigned)getHeapVersion()); }, getHeapVersion),
+#ifdef ESP8266
+      LABEL_VALUE(8, "Flash Mem:", [](TextBuffer &text) { text.printf("%uMB", (unsigned)(ESP.getFlashChipRealSize() / 1024 / 1024)); }, nullptr),
+#endif
+      LABEL_VALUE(9, "WiFi Strength:", [](TextBuffer &text) { text.printf("%ddB", (int)WiFi.RSSI()); }, getRssiVersion),
+#ifdef ESP8266
+      LABEL_VALUE(10, "Chip ID:", [](TextBuffer &text) { text.printf("%u", (unsigned)ESP.getChipId()); }, nullptr),
+      LABEL_VALUE(11, "VCC: ", [](TextBuffer &text) { printFixed(text, (ESP.getVcc() * 100 + 512) / 1024, 2, 2); text.print("V"); }, []() { return (uint32_t)ESP.getVcc() / 10; }),
+#endif
+      LABEL_VALUE(12, "CPU Freq.: ", [](TextBuffer &text) { text.printf("%uMHz", (unsigned)ESP.getCpuFreqMHz()); }, nullptr),
+      LABEL_VALUE(13, "Uptime: ", printUptime, getUptimeVersion),
+      LABEL_VALUE(14, "IP Address: ", [](TextBuffer &text) { IPAddress ip = WiFi.localIP(); text.printf("%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]); }, []() { return (uint32_t)WiFi.localIP(); }),
+      new FunctionWidget(0, 280, width, height - 280, drawResetInfo, nullptr)};
+  screens[4] = new Screen(aboutWidgets, sizeof(aboutWidgets) / sizeof(Widget *));
+#undef LABEL_VALUE
+}
+
+// Starts over with an empty frame if another screen was shown before
+void showScreen(Screen *next)
+{
+  if (shownScreen == next)
+  {
+    return;
+  }
+  gfx.fillBuffer(MINI_BLACK);
+  next->invalidate();
+  shownScreen = next;
 }
 
 void setup()
 {
   Serial.begin(SERIAL_BAUD);
+#ifndef BATTERY_MODE
+  // half a second of every wake would be too much on battery
   delay(500);
+#endif
   Serial.println("Starting...");
 
   loadPropertiesFromSpiffs();
@@ -184,11 +634,36 @@ void setup()
   gfx.init();
   gfx.fillBuffer(MINI_BLACK);
   gfx.setRotation(TFT_ROTATION);
+#ifdef DISPLAY_ST7789
+  tft.setDirtyRegions(gfx.getDirtyRegions());
+#endif
+#ifdef BENCHMARK_ICONS
+  benchmarkIcons();
+#endif
   gfx.commit();
+  initScreens();
 
   Serial.printf("TFT: w = %d, h = %d\n", tft.width(), tft.height());
 
+#ifdef BATTERY_MODE
+  // restores the clock, the cached weather is drawn with it
+  dutyCycle.begin();
+#endif
+  // the cached model stays on screen while WiFi and time come up
+  showProgress = !loadCachedWeather();
+#ifdef BATTERY_MODE
+  batteryWake();
+#endif
+
+#if defined(BENCHMARK_FLUSH) && defined(DISPLAY_ST7789)
+  benchmarkFlush();
+#endif
+
+#ifdef USE_NETWORK_TASK
+  xTaskCreatePinnedToCore(networkTask, "network", NETWORK_TASK_STACK, nullptr, 1, &networkTaskHandle, 0);
+#else
   connectWifi();
+#endif
 
   #ifdef TOUCH_ENABLED
   Serial.println("Initializing touch screen...");
@@ -222,18 +697,40 @@ void setup()
       yield();
     }
     touchController.saveCalibration();
+    shownScreen = nullptr;
   }
   #endif
 
-  carousel.setFrames(frames, frameCount);
-  carousel.disableAllIndicators();
-
+#ifdef USE_NETWORK_TASK
+  // show what the network task is doing until the first weather arrived
+  while (cachedWeather == nullptr && !weatherExchange.acquire())
+  {
+    if (progressExchange.acquire())
+    {
+      const ProgressSnapshot *progress = progressExchange.readSlot();
+      drawProgress(progress->percentage, progress->text);
+    }
+    delay(FRAME_MILLIS);
+  }
+  if (cachedWeather == nullptr)
+  {
+    showWeather(weatherExchange.readSlot());
+  }
+#else
   initTime();
 
-  // update the weather information
+  // without a cached model the first refresh blocks, there is nothing to show
   updateData();
+  while (cachedWeather == nullptr && weatherFetcher.isBusy())
+  {
+    drawProgress(weatherFetcher.getProgress(), "Updating weather...");
+    updateWeather(FRAME_MILLIS);
+    yield();
+  }
   lastDownloadUpdate = millis();
+#endif
 
+  showProgress = true;
   lastScreenChange = millis();
   timerPress = millis();
   canBtnPress = true;
@@ -247,7 +744,7 @@ bool btnClick;
 
 void loop()
 {
-  gfx.fillBuffer(MINI_BLACK);
+  long frameStart = millis();
   #ifdef TOUCH_ENABLED
   if (touchController.isTouched(0))
   {
@@ -266,45 +763,24 @@ void loop()
   }
   #endif
 
-  if (screen == 0)
-  {
-    drawTime();
-    drawWifiQuality();
-    int remainingTimeBudget = carousel.update();
-    if (remainingTimeBudget > 0)
-    {
-      // You can do some work here
-      // Don't do stuff if you are below your
-      // time budget.
-      delay(remainingTimeBudget);
-    }
-    drawCurrentWeather();
-    drawAstronomy();
-  }
-  else if (screen == 1)
-  {
-    drawCurrentWeatherDetail();
-  }
-  else if (screen == 2)
-  {
-    drawForecastTable(0);
-  }
-  else if (screen == 3)
-  {
-    drawForecastTable(4);
-  }
-  else if (screen == 4)
-  {
-    drawAbout();
-  }
+  // only widgets whose data changed redraw, idle frames draw nothing
+  showScreen(screens[screen]);
+  screens[screen]->update(&gfx);
   gfx.commit();
 
+#ifdef USE_NETWORK_TASK
+  if (weatherExchange.acquire())
+  {
+    showWeather(weatherExchange.readSlot());
+  }
+#else
   // Check if we should update weather information
   if ((UPDATE_INTERVAL_SECS > 0) && (millis() - lastDownloadUpdate > 1000 * UPDATE_INTERVAL_SECS))
   {
     updateData();
     lastDownloadUpdate = millis();
   }
+#endif
 
   // Check if screen should be changed automatically
   if ((SCREEN_CHANGE_SECS > 0) && (millis() - lastScreenChange > 1000 * SCREEN_CHANGE_SECS))
@@ -327,122 +803,266 @@ void loop()
     ESP.deepSleep(0, WAKE_RF_DEFAULT); // 0 delay = permanently to sleep
 #endif
 #ifdef ESP32
-// not yet implemented for esp32
+    // no wakeup source, only a reset ends it
+    esp_deep_sleep_start();
 #endif
   }
+
+  long frameTime = millis() - frameStart;
+#ifndef USE_NETWORK_TASK
+  // a running weather refresh gets what is left of the frame
+  if (frameTime < FRAME_MILLIS)
+  {
+    updateWeather(FRAME_MILLIS - frameTime);
+    frameTime = millis() - frameStart;
+  }
+#endif
+  if (frameTime < FRAME_MILLIS)
+  {
+    delay(FRAME_MILLIS - frameTime);
+  }
 }
 
-// Update the internet based information and update screen
+#ifdef BATTERY_MODE
+// One wake in battery mode: the cached weather is on screen already, now
+// download if that is due, draw again and sleep until the next minute
+void batteryWake()
+{
+  if (cachedWeather == nullptr || dutyCycle.isFetchDue(UPDATE_INTERVAL_SECS))
+  {
+    dutyCycle.requireRadio();
+    dutyCycle.fetchStarted();
+    uint32_t version = weatherFetcher.getVersion();
+    if (connectWifi(BATTERY_CONNECT_TIMEOUT))
+    {
+      // corrects the drift of the clock restored from the RTC timer
+      initTime();
+      updateData();
+      while (weatherFetcher.isBusy())
+      {
+        updateWeather(FRAME_MILLIS);
+        yield();
+      }
+    }
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    dutyCycle.fetchFinished(weatherFetcher.getVersion() != version);
+  }
+  showScreen(screens[0]);
+  screens[0]->update(&gfx);
+  gfx.commit();
+  dutyCycle.sleep(UPDATE_INTERVAL_SECS);
+}
+#endif
+
+// Starts refreshing the internet based information in the background
 void updateData()
+{
+  static uint8_t allowedHours[] = {12, 0};
+  weatherFetcher.setServer(OPEN_WEATHER_MAP_HOST, OPEN_WEATHER_MAP_PORT);
+  weatherFetcher.setLocation(OPEN_WEATHER_MAP_API_KEY, OPEN_WEATHER_MAP_LOCATION_ID);
+  weatherFetcher.setLanguage(OPEN_WEATHER_MAP_LANGUAGE);
+  weatherFetcher.setMetric(IS_METRIC);
+  weatherFetcher.setAllowedHours(allowedHours, sizeof(allowedHours));
+  weatherFetcher.start();
+}
+
+// Pumps a running refresh and shows its result once complete
+void updateWeather(uint16_t budget)
+{
+  if (weatherFetcher.update(budget))
+  {
+    showWeather(weatherFetcher.getModel());
+    saveCachedWeather(weatherFetcher.getModel());
+  }
+}
+
+// Location, language and units the model was downloaded for
+String getWeatherCacheKey()
+{
+  return OPEN_WEATHER_MAP_LOCATION_ID + "," + OPEN_WEATHER_MAP_LANGUAGE + "," + String(IS_METRIC);
+}
+
+// Shows the model of the last run if there is one, before any network access
+boolean loadCachedWeather()
+{
+  // the zone is needed for the cached times already, initTime() is yet to come
+  setenv("TZ", TIMEZONE.c_str(), 1);
+  tzset();
+
+  uint32_t start = millis();
+  cachedWeather = new WeatherModel();
+  if (!weatherCache.load(cachedWeather, getWeatherCacheKey(), &cachedWeatherTime))
+  {
+    delete cachedWeather;
+    cachedWeather = nullptr;
+    return false;
+  }
+  showWeather(cachedWeather);
+  showScreen(screens[screen]);
+  screens[screen]->update(&gfx);
+  gfx.commit();
+  Serial.printf("Cached weather from %u shown after %lu ms\n", cachedWeatherTime, (unsigned long)(millis() - start));
+  return true;
+}
+
+void saveCachedWeather(const WeatherModel *model)
 {
   time_t now = time(nullptr);
+  weatherCache.save(*model, getWeatherCacheKey(), now);
+}
 
-  gfx.fillBuffer(MINI_BLACK);
-  gfx.setFont(ArialRoundedMTBold_14);
+#ifdef USE_NETWORK_TASK
+// Keeps WiFi up and the weather fresh, never touches the display
+void networkTask(void *parameter)
+{
+  connectWifi();
+  initTime();
+  for (;;)
+  {
+    if (WiFi.status() != WL_CONNECTED)
+    {
+      connectWifi();
+    }
+    if (!weatherFetcher.isBusy() &&
+        (lastDownloadUpdate == 0 || (UPDATE_INTERVAL_SECS > 0 && millis() - lastDownloadUpdate > 1000 * UPDATE_INTERVAL_SECS)))
+    {
+      updateData();
+      lastDownloadUpdate = millis();
+    }
+    if (weatherFetcher.update(FRAME_MILLIS))
+    {
+      *weatherExchange.writeSlot() = *weatherFetcher.getModel();
+      weatherExchange.publish();
+      saveCachedWeather(weatherFetcher.getModel());
+    }
+    else if (!weatherFetcher.isBusy())
+    {
+      delay(100);
+    }
+    else
+    {
+      // let the idle task run, it feeds the watchdog of core 0
+      delay(1);
+    }
+  }
+}
+#endif
 
-  drawProgress(50, "Updating conditions...");
-  OpenWeatherMapCurrent *currentWeatherClient = new OpenWeatherMapCurrent();
-  currentWeatherClient->setMetric(IS_METRIC);
-  currentWeatherClient->setLanguage(OPEN_WEATHER_MAP_LANGUAGE);
-  currentWeatherClient->updateCurrentById(&currentWeather, OPEN_WEATHER_MAP_API_KEY, OPEN_WEATHER_MAP_LOCATION_ID);
-  delete currentWeatherClient;
-  currentWeatherClient = nullptr;
-
-  drawProgress(70, "Updating forecasts...");
-  OpenWeatherMapForecast *forecastClient = new OpenWeatherMapForecast();
-  forecastClient->setMetric(IS_METRIC);
-  forecastClient->setLanguage(OPEN_WEATHER_MAP_LANGUAGE);
-  uint8_t allowedHours[] = {12, 0};
-  forecastClient->setAllowedHours(allowedHours, sizeof(allowedHours));
-  forecastClient->updateForecastsById(forecasts, OPEN_WEATHER_MAP_API_KEY, OPEN_WEATHER_MAP_LOCATION_ID, MAX_FORECASTS);
-  delete forecastClient;
-  forecastClient = nullptr;
-
-  drawProgress(80, "Updating astronomy...");
+// Switches the screens to a new model, runs on the drawing side
+void showWeather(const WeatherModel *model)
+{
+  weather = model;
+  if (cachedWeather != nullptr && model != cachedWeather)
+  {
+    // fresh data replaced the cached model for good
+    delete cachedWeather;
+    cachedWeather = nullptr;
+  }
+
+  time_t now = time(nullptr);
+  if (now < NTP_MIN_VALID_EPOCH)
+  {
+    // not synchronized yet, the moon of the cached observation is close enough
+    now = model->current.observationTime;
+  }
   Astronomy *astronomy = new Astronomy();
   moonData = astronomy->calculateMoonData(now);
   moonData.phase = astronomy->calculateMoonPhase(now);
   delete astronomy;
   astronomy = nullptr;
+  moonFrame = getMoonFrame(getMoonAge());
   // https://github.com/ThingPulse/esp8266-weather-station/issues/144 prevents using this
   //   // 'now' has to be UTC, lat/lng in degrees not raadians
-  //   SunMoonCalc *smCalc = new SunMoonCalc(now - dstOffset, currentWeather.lat, currentWeather.lon);
+  //   SunMoonCalc *smCalc = new SunMoonCalc(now - dstOffset, weather->current.lat, weather->current.lon);
   //   moonData = smCalc->calculateSunAndMoonData().moon;
   //   delete smCalc;
   //   smCalc = nullptr;
   Serial.printf("Free mem: %d\n", ESP.getFreeHeap());
-
-  delay(1000);
+  TextCache *textCache = gfx.getTextCache();
+  Serial.printf("Text cache: %u hits, %u misses, %u bytes\n", textCache->getHits(), textCache->getMisses(),
+                (unsigned)textCache->getBytesUsed());
+  weatherVersion++;
 }
 
 // Progress bar helper
-void drawProgress(uint8_t percentage, String text)
+void drawProgress(uint8_t percentage, const char *text)
 {
-  gfx.fillBuffer(MINI_BLACK);
-  gfx.drawPalettedBitmapFromPgm((tft.width() - ThingPulseLogo_Width) / 2, 5, ThingPulseLogo);
-  gfx.setFont(ArialRoundedMTBold_14);
-  gfx.setTextAlignment(TEXT_ALIGN_CENTER);
-  gfx.setColor(MINI_WHITE);
-  gfx.drawString(tft.width() / 2, 90, "https://thingpulse.com");
-  gfx.setColor(MINI_YELLOW);
-
-  gfx.drawString(tft.width() / 2, 146, text);
-  gfx.setColor(MINI_WHITE);
-  gfx.drawRect(10, 168, tft.width() - 2 * 10, 15);
-  gfx.setColor(MINI_BLUE);
-  gfx.fillRect(12, 170, (tft.width() - 2 * 12) * percentage / 100, 11);
-
+#ifdef USE_NETWORK_TASK
+  // called by connectWifi() and initTime() on the network task
+  if (xTaskGetCurrentTaskHandle() == networkTaskHandle)
+  {
+    ProgressSnapshot *progress = progressExchange.writeSlot();
+    progress->percentage = percentage;
+    strlcpy(progress->text, text, sizeof(progress->text));
+    progressExchange.publish();
+    return;
+  }
+#endif
+  progressPercentage = percentage;
+  if (strncmp(text, progressText, sizeof(progressText) - 1) != 0)
+  {
+    strlcpy(progressText, text, sizeof(progressText));
+    progressVersion++;
+  }
+  if (!showProgress)
+  {
+    // booting with cached weather, keep the clock of the shown screen going
+    showScreen(screens[screen]);
+    screens[screen]->update(&gfx);
+    gfx.commit();
+    return;
+  }
+  showScreen(progressScreen);
+  progressScreen->update(&gfx);
   gfx.commit();
 }
 
-// draws the clock
-void drawTime()
+// date line above the clock, empty until the time is known
+void printDate(TextBuffer &text)
 {
-  char time_str[11];
   time_t now = time(nullptr);
+  if (now < NTP_MIN_VALID_EPOCH)
+  {
+    return;
+  }
   struct tm *timeinfo = localtime(&now);
+  text.printf("%s %s %d %d", WDAY_NAMES[timeinfo->tm_wday], MONTH_NAMES[timeinfo->tm_mon], timeinfo->tm_mday, 1900 + timeinfo->tm_year);
+}
 
-  gfx.setTextAlignment(TEXT_ALIGN_CENTER);
-  gfx.setFont(ArialRoundedMTBold_14);
-  gfx.setColor(MINI_WHITE);
-  String date = WDAY_NAMES[timeinfo->tm_wday] + " " + MONTH_NAMES[timeinfo->tm_mon] + " " + String(timeinfo->tm_mday) + " " + String(1900 + timeinfo->tm_year);
-  gfx.drawString(tft.width() / 2, 6, date);
-
-  gfx.setFont(ArialRoundedMTBold_36);
-
+// the clock digits, a DigitLabel only redraws the ones that changed
+void printClock(TextBuffer &text)
+{
+  time_t now = time(nullptr);
+  if (now < NTP_MIN_VALID_EPOCH)
+  {
+    // only happens while showing cached weather during boot
+    text.print("--:--");
+    return;
+  }
+  struct tm *timeinfo = localtime(&now);
+  int hour = timeinfo->tm_hour;
   if (IS_STYLE_12HR)
-  {                                               // 12:00
-    int hour = (timeinfo->tm_hour + 11) % 12 + 1; // take care of noon and midnight
-    if (IS_STYLE_HHMM)
-    {
-      sprintf(time_str, "%2d:%02d\n", hour, timeinfo->tm_min); // hh:mm
-    }
-    else
-    {
-      sprintf(time_str, "%2d:%02d:%02d\n", hour, timeinfo->tm_min, timeinfo->tm_sec); // hh:mm:ss
-    }
+  {
+    hour = (hour + 11) % 12 + 1; // take care of noon and midnight
+    text.printf("%2d:%02d", hour, timeinfo->tm_min);
   }
   else
-  { // 24:00
-    if (IS_STYLE_HHMM)
-    {
-      sprintf(time_str, "%02d:%02d\n", timeinfo->tm_hour, timeinfo->tm_min); // hh:mm
-    }
-    else
-    {
-      sprintf(time_str, "%02d:%02d:%02d\n", timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec); // hh:mm:ss
-    }
+  {
+    text.printf("%02d:%02d", hour, timeinfo->tm_min);
   }
+  if (!IS_STYLE_HHMM)
+  {
+    text.printf(":%02d", timeinfo->tm_sec);
+  }
+}
 
-  gfx.drawString(tft.width() / 2, 20, time_str);
-
-  gfx.setTextAlignment(TEXT_ALIGN_LEFT);
-  gfx.setFont(ArialMT_Plain_10);
-  gfx.setColor(MINI_BLUE);
-  if (IS_STYLE_12HR)
+void printMeridiem(TextBuffer &text)
+{
+  time_t now = time(nullptr);
+  if (IS_STYLE_12HR && now >= NTP_MIN_VALID_EPOCH)
   {
-    sprintf(time_str, "\n%s", timeinfo->tm_hour >= 12 ? "PM" : "AM");
-    gfx.drawString(195, 27, time_str);
+    text.print(localtime(&now)->tm_hour >= 12 ? "PM" : "AM");
   }
 }
 
@@ -450,7 +1070,7 @@ void drawTime()
 void drawCurrentWeather()
 {
   gfx.setTransparentColor(MINI_BLACK);
-  gfx.drawPalettedBitmapFromPgm(0, 55, getMeteoconIconFromProgmem(currentWeather.icon));
+  gfx.drawPalettedBitmapFromPgm(0, 55, getMeteoconIconFromProgmem(weather->current.icon));
 
   // Weather Text
   gfx.setFont(ArialRoundedMTBold_14);
@@ -462,38 +1082,53 @@ void drawCurrentWeather()
   gfx.setColor(MINI_WHITE);
   gfx.setTextAlignment(TEXT_ALIGN_RIGHT);
 
-  gfx.drawString(tft.width() - 20, 78, String(currentWeather.temp, 1) + (IS_METRIC ? "°C" : "°F"));
+  Text<16> temperature;
+  printFixed(temperature, weather->current.temp, 1, 1);
+  temperature.print(getUnit("°C", "°F"));
+  gfx.drawString(tft.width() - 20, 78, temperature.c_str());
 
   gfx.setFont(ArialRoundedMTBold_14);
   gfx.setColor(MINI_YELLOW);
   gfx.setTextAlignment(TEXT_ALIGN_RIGHT);
-  gfx.drawString(tft.width() - 20, 118, currentWeather.description);
+  gfx.drawString(tft.width() - 20, 118, weather->text(weather->current.description));
+
+  if (weather == cachedWeather)
+  {
+    // saved by an earlier run, a refresh is on its way
+    Text<16> fetched;
+    fetched.print("Cached ");
+    printTime(fetched, cachedWeatherTime);
+    gfx.setFont(ArialMT_Plain_10);
+    gfx.setColor(MINI_BLUE);
+    gfx.drawString(tft.width() - 20, 135, fetched.c_str());
+  }
 }
 
-void drawForecast1(MiniGrafx *display, CarouselState *state, int16_t x, int16_t y)
+// carousel frames, x and y are the top left corner of the frame
+void drawForecast1(int16_t x, int16_t y)
 {
   uint8_t shift_x = tft.width() /itemsOnCarousel;
   for (uint8_t i = 0; i < itemsOnCarousel; i++)
   {
-    drawForecastDetail(x + 10 + shift_x * i, y + 165, i);
+    drawForecastDetail(x + 10 + shift_x * i, y + 15, i);
   }
 }
 
-void drawForecast2(MiniGrafx *display, CarouselState *state, int16_t x, int16_t y)
+void drawForecast2(int16_t x, int16_t y)
 {
   uint8_t shift_x = tft.width() /itemsOnCarousel;
   for (uint8_t i = 0; i < itemsOnCarousel; i++)
   {
-    drawForecastDetail(x + 10 + shift_x * i, y + 165, (i + itemsOnCarousel));
+    drawForecastDetail(x + 10 + shift_x * i, y + 15, (i + itemsOnCarousel));
   }
 }
 
-void drawForecast3(MiniGrafx *display, CarouselState *state, int16_t x, int16_t y)
+void drawForecast3(int16_t x, int16_t y)
 {
   uint8_t shift_x = tft.width() /itemsOnCarousel;
   for (uint8_t i = 0; i < itemsOnCarousel; i++)
   {
-    drawForecastDetail(x + 10 + shift_x * i, y + 165, (i + 2*itemsOnCarousel));
+    drawForecastDetail(x + 10 + shift_x * i, y + 15, (i + 2*itemsOnCarousel));
   }
 }
 
@@ -503,28 +1138,30 @@ void drawForecastDetail(uint16_t x, uint16_t y, uint8_t dayIndex)
   gfx.setColor(MINI_YELLOW);
   gfx.setFont(ArialRoundedMTBold_14);
   gfx.setTextAlignment(TEXT_ALIGN_CENTER);
-  time_t time = forecasts[dayIndex].observationTime;
+  time_t time = weather->forecasts[dayIndex].observationTime;
   struct tm *timeinfo = localtime(&time);
-  gfx.drawString(x + 25, y - 15, WDAY_NAMES[timeinfo->tm_wday] + " " + String(timeinfo->tm_hour) + ":00");
+  Text<16> text;
+  text.printf("%s %d:00", WDAY_NAMES[timeinfo->tm_wday], timeinfo->tm_hour);
+  gfx.drawString(x + 25, y - 15, text.c_str());
 
   gfx.setColor(MINI_WHITE);
-  gfx.drawString(x + 25, y, String(forecasts[dayIndex].temp, 1) + (IS_METRIC ? "°C" : "°F"));
+  text.clear();
+  printFixed(text, weather->forecasts[dayIndex].temp, 1, 1);
+  text.print(getUnit("°C", "°F"));
+  gfx.drawString(x + 25, y, text.c_str());
 
-  gfx.drawPalettedBitmapFromPgm(x, y + 15, getMiniMeteoconIconFromProgmem(forecasts[dayIndex].icon));
+  gfx.drawPalettedBitmapFromPgm(x, y + 15, getMiniMeteoconIconFromProgmem(weather->forecasts[dayIndex].icon));
   gfx.setColor(MINI_BLUE);
-  gfx.drawString(x + 25, y + 60, String(forecasts[dayIndex].rain, 1) + (IS_METRIC ? "mm" : "in"));
+  text.clear();
+  printFixed(text, weather->forecasts[dayIndex].rain, 2, 1);
+  text.print(getUnit("mm", "in"));
+  gfx.drawString(x + 25, y + 60, text.c_str());
 }
 
 // draw moonphase and sunrise/set and moonrise/set
 void drawAstronomy()
 {
-
-  gfx.setFont(MoonPhases_Regular_36);
-  gfx.setColor(MINI_WHITE);
-  gfx.setTextAlignment(TEXT_ALIGN_CENTER);
-  gfx.drawString(tft.width() / 2, 275, String((char)(97 + (moonData.illumination * 26))));
-
-  gfx.setColor(MINI_WHITE);
+  // the moon itself is an Icon widget on top
   gfx.setFont(ArialRoundedMTBold_14);
   gfx.setTextAlignment(TEXT_ALIGN_CENTER);
   gfx.setColor(MINI_YELLOW);
@@ -534,52 +1171,36 @@ void drawAstronomy()
   gfx.setColor(MINI_YELLOW);
   gfx.drawString(5, 250, SUN_MOON_TEXT[0]);
   gfx.setColor(MINI_WHITE);
-  time_t time = currentWeather.sunrise;
-  gfx.drawString(5, 276, SUN_MOON_TEXT[1] + ":");
-  gfx.drawString(45, 276, getTime(&time));
-  time = currentWeather.sunset;
-  gfx.drawString(5, 291, SUN_MOON_TEXT[2] + ":");
-  gfx.drawString(45, 291, getTime(&time));
+  Text<16> text;
+  text.printf("%s:", SUN_MOON_TEXT[1]);
+  gfx.drawString(5, 276, text.c_str());
+  text.clear();
+  printTime(text, weather->current.sunrise);
+  gfx.drawString(45, 276, text.c_str());
+  text.clear();
+  text.printf("%s:", SUN_MOON_TEXT[2]);
+  gfx.drawString(5, 291, text.c_str());
+  text.clear();
+  printTime(text, weather->current.sunset);
+  gfx.drawString(45, 291, text.c_str());
 
   gfx.setTextAlignment(TEXT_ALIGN_RIGHT);
   gfx.setColor(MINI_YELLOW);
   gfx.drawString(tft.width() - 5, 250, SUN_MOON_TEXT[3]);
   gfx.setColor(MINI_WHITE);
-  float lunarMonth = 29.53;
-  // approximate moon age
-  gfx.drawString(tft.width() - 5, 276, String(moonData.phase <= 4 ? lunarMonth * moonData.illumination / 2.0 : lunarMonth - moonData.illumination * lunarMonth / 2.0, 1) + "d");
-  gfx.drawString(tft.width() - 5, 291, String(moonData.illumination * 100, 0) + "%");
-  gfx.drawString(tft.width() - 45, 276, SUN_MOON_TEXT[4] + ":");
-  gfx.drawString(tft.width() - 45, 291, SUN_MOON_TEXT[5] + ":");
-}
-
-void drawCurrentWeatherDetail()
-{
-  gfx.setFont(ArialRoundedMTBold_14);
-  gfx.setTextAlignment(TEXT_ALIGN_CENTER);
-  gfx.setColor(MINI_WHITE);
-  gfx.drawString(tft.width() / 2, 2, "Current Conditions");
-
-  // String weatherIcon;
-  // String weatherText;
-  drawLabelValue(0, "Temperature:", String(currentWeather.temp, 1) + (IS_METRIC ? "°C" : "°F"));
-  drawLabelValue(1, "Wind Speed:", String(currentWeather.windSpeed, 1) + (IS_METRIC ? "m/s" : "mph"));
-  drawLabelValue(2, "Wind Dir:", String(currentWeather.windDeg, 1) + "°");
-  drawLabelValue(3, "Humidity:", String(currentWeather.humidity) + "%");
-  drawLabelValue(4, "Pressure:", String(currentWeather.pressure) + "hPa");
-  drawLabelValue(5, "Clouds:", String(currentWeather.clouds) + "%");
-  drawLabelValue(6, "Visibility:", String(currentWeather.visibility) + "m");
-}
-
-void drawLabelValue(uint8_t line, String label, String value)
-{
-  const uint8_t labelX = 15;
-  const uint8_t valueX = tft.width() / 2;
-  gfx.setTextAlignment(TEXT_ALIGN_LEFT);
-  gfx.setColor(MINI_YELLOW);
-  gfx.drawString(labelX, 30 + line * 15, label);
-  gfx.setColor(MINI_WHITE);
-  gfx.drawString(valueX, 30 + line * 15, value);
+  text.clear();
+  printFixed(text, lround(getMoonAge() * 10), 1, 1);
+  text.print("d");
+  gfx.drawString(tft.width() - 5, 276, text.c_str());
+  text.clear();
+  text.printf("%ld%%", lround(moonData.illumination * 100));
+  gfx.drawString(tft.width() - 5, 291, text.c_str());
+  text.clear();
+  text.printf("%s:", SUN_MOON_TEXT[4]);
+  gfx.drawString(tft.width() - 45, 276, text.c_str());
+  text.clear();
+  text.printf("%s:", SUN_MOON_TEXT[5]);
+  gfx.drawString(tft.width() - 45, 291, text.c_str());
 }
 
 // converts the dBm to a range between 0 and 100%
@@ -606,7 +1227,9 @@ void drawWifiQuality()
   gfx.setColor(MINI_WHITE);
   gfx.setFont(ArialMT_Plain_10);
   gfx.setTextAlignment(TEXT_ALIGN_RIGHT);
-  gfx.drawString(tft.width() - 10, 9, String(quality) + "%");
+  Text<8> text;
+  text.printf("%d%%", quality);
+  gfx.drawString(tft.width() - 10, 9, text.c_str());
   for (int8_t i = 0; i < 4; i++)
   {
     for (int8_t j = 0; j < 2 * (i + 1); j++)
@@ -627,11 +1250,8 @@ void drawForecastTable(uint8_t start)
   gfx.drawString(tft.width() / 2, 2, "Forecasts");
   uint16_t y = 0;
 
-  String degreeSign = "°F";
-  if (IS_METRIC)
-  {
-    degreeSign = "°C";
-  }
+  const char *degreeSign = getUnit("°C", "°F");
+  Text<24> text;
   int firstColumnLabelX = 50;
   int firstColumnValueX = firstColumnLabelX + 20;
   int secondColumnLabelX = tft.width() / 2 + 10;
@@ -646,83 +1266,80 @@ void drawForecastTable(uint8_t start)
     }
     gfx.setColor(MINI_WHITE);
     gfx.setTextAlignment(TEXT_ALIGN_CENTER);
-    time_t time = forecasts[i].observationTime;
+    time_t time = weather->forecasts[i].observationTime;
     struct tm *timeinfo = localtime(&time);
-    gfx.drawString(tft.width() / 2, y - 15, WDAY_NAMES[timeinfo->tm_wday] + " " + String(timeinfo->tm_hour) + ":00");
+    text.clear();
+    text.printf("%s %d:00", WDAY_NAMES[timeinfo->tm_wday], timeinfo->tm_hour);
+    gfx.drawString(tft.width() / 2, y - 15, text.c_str());
 
-    gfx.drawPalettedBitmapFromPgm(0, 5 + y, getMiniMeteoconIconFromProgmem(forecasts[i].icon));
+    gfx.drawPalettedBitmapFromPgm(0, 5 + y, getMiniMeteoconIconFromProgmem(weather->forecasts[i].icon));
     gfx.setTextAlignment(TEXT_ALIGN_LEFT);
     gfx.setColor(MINI_YELLOW);
     gfx.setFont(ArialRoundedMTBold_14);
-    gfx.drawString(0, y - 8, forecasts[i].main);
+    gfx.drawString(0, y - 8, weather->text(weather->forecasts[i].main));
     gfx.setTextAlignment(TEXT_ALIGN_LEFT);
 
     gfx.setColor(MINI_BLUE);
     gfx.drawString(firstColumnLabelX, y, "T:");
     gfx.setColor(MINI_WHITE);
-    gfx.drawString(firstColumnValueX, y, String(forecasts[i].temp, 0) + degreeSign);
+    text.clear();
+    printFixed(text, weather->forecasts[i].temp, 1, 0);
+    text.print(degreeSign);
+    gfx.drawString(firstColumnValueX, y, text.c_str());
 
     gfx.setColor(MINI_BLUE);
     gfx.drawString(firstColumnLabelX, y + 15, "H:");
     gfx.setColor(MINI_WHITE);
-    gfx.drawString(firstColumnValueX, y + 15, String(forecasts[i].humidity) + "%");
+    text.clear();
+    text.printf("%u%%", weather->forecasts[i].humidity);
+    gfx.drawString(firstColumnValueX, y + 15, text.c_str());
 
     gfx.setColor(MINI_BLUE);
     gfx.drawString(firstColumnLabelX, y + 30, "P: ");
     gfx.setColor(MINI_WHITE);
-    gfx.drawString(firstColumnValueX, y + 30, String(forecasts[i].rain, 2) + (IS_METRIC ? "mm" : "in"));
+    text.clear();
+    printFixed(text, weather->forecasts[i].rain, 2, 2);
+    text.print(getUnit("mm", "in"));
+    gfx.drawString(firstColumnValueX, y + 30, text.c_str());
 
     gfx.setColor(MINI_BLUE);
     gfx.drawString(secondColumnLabelX, y, "Pr:");
     gfx.setColor(MINI_WHITE);
-    gfx.drawString(secondColumnValueX, y, String(forecasts[i].pressure, 0) + "hPa");
+    text.clear();
+    text.printf("%uhPa", weather->forecasts[i].pressure);
+    gfx.drawString(secondColumnValueX, y, text.c_str());
 
     gfx.setColor(MINI_BLUE);
     gfx.drawString(secondColumnLabelX, y + 15, "WSp:");
     gfx.setColor(MINI_WHITE);
-    gfx.drawString(secondColumnValueX, y + 15, String(forecasts[i].windSpeed, 0) + (IS_METRIC ? "m/s" : "mph"));
+    text.clear();
+    printFixed(text, weather->forecasts[i].windSpeed, 1, 0);
+    text.print(getUnit("m/s", "mph"));
+    gfx.drawString(secondColumnValueX, y + 15, text.c_str());
 
     gfx.setColor(MINI_BLUE);
     gfx.drawString(secondColumnLabelX, y + 30, "WDi: ");
     gfx.setColor(MINI_WHITE);
-    gfx.drawString(secondColumnValueX, y + 30, String(forecasts[i].windDeg, 0) + "°");
+    text.clear();
+    text.printf("%u°", weather->forecasts[i].windDeg);
+    gfx.drawString(secondColumnValueX, y + 30, text.c_str());
   }
 }
 
-void drawAbout()
+void printUptime(TextBuffer &text)
 {
-  gfx.fillBuffer(MINI_BLACK);
-  gfx.drawPalettedBitmapFromPgm((tft.width() - ThingPulseLogo_Width) / 2, 5, ThingPulseLogo);
-
-  gfx.setFont(ArialRoundedMTBold_14);
-  gfx.setTextAlignment(TEXT_ALIGN_CENTER);
-  gfx.setColor(MINI_WHITE);
-  gfx.drawString(tft.width() / 2, 90, "https://thingpulse.com");
-
-  gfx.setFont(ArialRoundedMTBold_14);
-  gfx.setTextAlignment(TEXT_ALIGN_CENTER);
-  drawLabelValue(7, "Heap Mem:", String(ESP.getFreeHeap() / 1024) + "kb");
-#ifdef ESP8266
-  drawLabelValue(8, "Flash Mem:", String(ESP.getFlashChipRealSize() / 1024 / 1024) + "MB");
-#endif
-  drawLabelValue(9, "WiFi Strength:", String(WiFi.RSSI()) + "dB");
-#ifdef ESP8266
-  drawLabelValue(10, "Chip ID:", String(ESP.getChipId()));
-#endif
-#ifdef ESP8266
-  drawLabelValue(11, "VCC: ", String(ESP.getVcc() / 1024.0) + "V");
-#endif
-  drawLabelValue(12, "CPU Freq.: ", String(ESP.getCpuFreqMHz()) + "MHz");
-  char time_str[15];
   const uint32_t millis_in_day = 1000 * 60 * 60 * 24;
   const uint32_t millis_in_hour = 1000 * 60 * 60;
   const uint32_t millis_in_minute = 1000 * 60;
   uint8_t days = millis() / (millis_in_day);
   uint8_t hours = (millis() - (days * millis_in_day)) / millis_in_hour;
   uint8_t minutes = (millis() - (days * millis_in_day) - (hours * millis_in_hour)) / millis_in_minute;
-  sprintf(time_str, "%2dd%2dh%2dm", days, hours, minutes);
-  drawLabelValue(13, "Uptime: ", time_str);
-  drawLabelValue(14, "IP Address: ", WiFi.localIP().toString());
+  text.printf("%2dd%2dh%2dm", days, hours, minutes);
+}
+
+void drawResetInfo()
+{
+  gfx.setFont(ArialRoundedMTBold_14);
   gfx.setTextAlignment(TEXT_ALIGN_LEFT);
   gfx.setColor(MINI_YELLOW);
   gfx.drawString(15, 280, "Last Reset: ");
@@ -740,13 +1357,10 @@ void calibrationCallback(int16_t x, int16_t y)
 }
 #endif
 
-String getTime(time_t *timestamp)
+void printTime(TextBuffer &text, time_t timestamp)
 {
-  struct tm *timeInfo = localtime(timestamp);
-
-  char buf[6];
-  sprintf(buf, "%02d:%02d", timeInfo->tm_hour, timeInfo->tm_min);
-  return String(buf);
+  struct tm *timeInfo = localtime(&timestamp);
+  text.printf("%02d:%02d", timeInfo->tm_hour, timeInfo->tm_min);
 }
 
 void loadPropertiesFromSpiffs()
@@ -1,430 +0,0 @@
-#pragma once
-
-// Created by http://oleddisplay.squix.ch/ Consider a donation
-// In case of problems make sure that you are using the font file with the correct version!
-
-// Font face https://www.dafont.com/moon-phases.font
-const char MoonPhases_Regular_36[] PROGMEM = {
-  0x24, // Width: 36
-  0x25, // Height: 37
-  0x20, // First Char: 32
-  0xE0, // Numbers of Chars: 224
-
-  // Jump Table:
-  0xFF, 0xFF, 0x00, 0x24,  // 32:65535
-  0x00, 0x00, 0x23, 0x0B,  // 33:0
-  0x00, 0x23, 0x35, 0x0D,  // 34:35
-  0x00, 0x58, 0x71, 0x17,  // 35:88
-  0x00, 0xC9, 0x5E, 0x17,  // 36:201
-  0x01, 0x27, 0x78, 0x18,  // 37:295
-  0x01, 0x9F, 0x73, 0x19,  // 38:415
-  0x02, 0x12, 0x1B, 0x08,  // 39:530
-  0x02, 0x2D, 0x2F, 0x0C,  // 40:557
-  0x02, 0x5C, 0x2C, 0x0C,  // 41:604
-  0x02, 0x88, 0xAD, 0x24,  // 42:648
-  0x03, 0x35, 0xA3, 0x23,  // 43:821
-  0x03, 0xD8, 0x23, 0x0B,  // 44:984
-  0x03, 0xFB, 0x59, 0x15,  // 45:1019
-  0x04, 0x54, 0x23, 0x0B,  // 46:1108
-  0x04, 0x77, 0x4D, 0x13,  // 47:1143
-  0x04, 0xC4, 0xAD, 0x24,  // 48:1220
-  0x05, 0x71, 0x64, 0x17,  // 49:1393
-  0x05, 0xD5, 0x5F, 0x17,  // 50:1493
-  0x06, 0x34, 0x5E, 0x17,  // 51:1588
-  0x06, 0x92, 0x63, 0x17,  // 52:1682
-  0x06, 0xF5, 0x5E, 0x17,  // 53:1781
-  0x07, 0x53, 0x68, 0x17,  // 54:1875
-  0x07, 0xBB, 0x66, 0x17,  // 55:1979
-  0x08, 0x21, 0x68, 0x17,  // 56:2081
-  0x08, 0x89, 0x68, 0x17,  // 57:2185
-  0x08, 0xF1, 0x23, 0x0B,  // 58:2289
-  0x09, 0x14, 0x23, 0x0B,  // 59:2324
-  0x09, 0x37, 0x7D, 0x1D,  // 60:2359
-  0xFF, 0xFF, 0x00, 0x00,  // 61:65535
-  0x09, 0xB4, 0x7C, 0x1D,  // 62:2484
-  0x0A, 0x30, 0x44, 0x0F,  // 63:2608
-  0x0A, 0x74, 0xA8, 0x24,  // 64:2676
-  0x0B, 0x1C, 0xA8, 0x24,  // 65:2844
-  0x0B, 0xC4, 0xA8, 0x24,  // 66:3012
-  0x0C, 0x6C, 0xA8, 0x24,  // 67:3180
-  0x0D, 0x14, 0xA8, 0x24,  // 68:3348
-  0x0D, 0xBC, 0xA8, 0x24,  // 69:3516
-  0x0E, 0x64, 0xA8, 0x24,  // 70:3684
-  0x0F, 0x0C, 0xA8, 0x24,  // 71:3852
-  0x0F, 0xB4, 0xA8, 0x24,  // 72:4020
-  0x10, 0x5C, 0xA8, 0x24,  // 73:4188
-  0x11, 0x04, 0xA8, 0x24,  // 74:4356
-  0x11, 0xAC, 0xA8, 0x24,  // 75:4524
-  0x12, 0x54, 0xA8, 0x24,  // 76:4692
-  0x12, 0xFC, 0xA8, 0x24,  // 77:4860
-  0x13, 0xA4, 0xA8, 0x24,  // 78:5028
-  0x14, 0x4C, 0xAD, 0x24,  // 79:5196
-  0x14, 0xF9, 0xAD, 0x24,  // 80:5369
-  0x15, 0xA6, 0xAD, 0x24,  // 81:5542
-  0x16, 0x53, 0xAD, 0x24,  // 82:5715
-  0x17, 0x00, 0xAD, 0x24,  // 83:5888
-  0x17, 0xAD, 0xAD, 0x24,  // 84:6061
-  0x18, 0x5A, 0xAD, 0x24,  // 85:6234
-  0x19, 0x07, 0xAD, 0x24,  // 86:6407
-  0x19, 0xB4, 0xAD, 0x24,  // 87:6580
-  0x1A, 0x61, 0xAD, 0x24,  // 88:6753
-  0x1B, 0x0E, 0xAD, 0x24,  // 89:6926
-  0x1B, 0xBB, 0xAD, 0x24,  // 90:7099
-  0x1C, 0x68, 0x2F, 0x0C,  // 91:7272
-  0x1C, 0x97, 0x46, 0x13,  // 92:7319
-  0x1C, 0xDD, 0x28, 0x0C,  // 93:7389
-  0x1D, 0x05, 0x68, 0x17,  // 94:7429
-  0xFF, 0xFF, 0x00, 0x12,  // 95:65535
-  0x1D, 0x6D, 0x48, 0x16,  // 96:7533
-  0x1D, 0xB5, 0xA3, 0x23,  // 97:7605
-  0x1E, 0x58, 0xA3, 0x23,  // 98:7768
-  0x1E, 0xFB, 0xA8, 0x23,  // 99:7931
-  0x1F, 0xA3, 0xA8, 0x23,  // 100:8099
-  0x20, 0x4B, 0xA3, 0x23,  // 101:8267
-  0x20, 0xEE, 0xA3, 0x23,  // 102:8430
-  0x21, 0x91, 0xA3, 0x23,  // 103:8593
-  0x22, 0x34, 0xA3, 0x23,  // 104:8756
-  0x22, 0xD7, 0xA3, 0x23,  // 105:8919
-  0x23, 0x7A, 0xA3, 0x23,  // 106:9082
-  0x24, 0x1D, 0xA3, 0x23,  // 107:9245
-  0x24, 0xC0, 0xA3, 0x23,  // 108:9408
-  0x25, 0x63, 0xA3, 0x23,  // 109:9571
-  0x26, 0x06, 0x9E, 0x23,  // 110:9734
-  0x26, 0xA4, 0x99, 0x23,  // 111:9892
-  0x27, 0x3D, 0x8F, 0x23,  // 112:10045
-  0x27, 0xCC, 0x85, 0x23,  // 113:10188
-  0x28, 0x51, 0x77, 0x23,  // 114:10321
-  0x28, 0xC8, 0x68, 0x23,  // 115:10440
-  0x29, 0x30, 0x5A, 0x23,  // 116:10544
-  0x29, 0x8A, 0x5A, 0x23,  // 117:10634
-  0x29, 0xE4, 0x5A, 0x23,  // 118:10724
-  0x2A, 0x3E, 0x5F, 0x23,  // 119:10814
-  0x2A, 0x9D, 0x5F, 0x23,  // 120:10909
-  0x2A, 0xFC, 0x5A, 0x23,  // 121:11004
-  0x2B, 0x56, 0x5A, 0x23,  // 122:11094
-  0x2B, 0xB0, 0x2A, 0x0C,  // 123:11184
-  0x2B, 0xDA, 0x28, 0x0D,  // 124:11226
-  0x2C, 0x02, 0x36, 0x0C,  // 125:11266
-  0x2C, 0x38, 0x68, 0x17,  // 126:11320
-  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
-  0x2C, 0xA0, 0x5A, 0x14,  // 128:11424
-  0x2C, 0xFA, 0x2C, 0x0E,  // 129:11514
-  0x2D, 0x26, 0x45, 0x10,  // 130:11558
-  0xFF, 0xFF, 0x00, 0x24,  // 131:65535
-  0xFF, 0xFF, 0x00, 0x22,  // 132:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 133:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 134:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 135:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 136:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 137:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 138:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 139:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 140:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 141:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 142:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 143:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 144:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 145:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 146:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 147:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 148:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 149:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 150:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 151:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 152:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 153:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 154:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 155:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 156:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 157:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 158:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 159:65535
-  0xFF, 0xFF, 0x00, 0x24,  // 160:65535
-  0x2D, 0x6B, 0x23, 0x0B,  // 161:11627
-  0x2D, 0x8E, 0x5F, 0x17,  // 162:11662
-  0x2D, 0xED, 0x5F, 0x17,  // 163:11757
-  0x2E, 0x4C, 0x69, 0x17,  // 164:11852
-  0x2E, 0xB5, 0x6B, 0x17,  // 165:11957
-  0x2F, 0x20, 0x28, 0x0D,  // 166:12064
-  0x2F, 0x48, 0x5F, 0x17,  // 167:12104
-  0x2F, 0xA7, 0x4D, 0x16,  // 168:12199
-  0x2F, 0xF4, 0x8D, 0x1E,  // 169:12276
-  0x30, 0x81, 0x49, 0x11,  // 170:12417
-  0x30, 0xCA, 0x5A, 0x13,  // 171:12490
-  0x31, 0x24, 0x7C, 0x1D,  // 172:12580
-  0x31, 0xA0, 0x59, 0x15,  // 173:12704
-  0x31, 0xF9, 0x90, 0x1F,  // 174:12793
-  0x32, 0x89, 0x4D, 0x12,  // 175:12937
-  0x32, 0xD6, 0x3E, 0x10,  // 176:13014
-  0x33, 0x14, 0x7D, 0x1D,  // 177:13076
-  0x33, 0x91, 0x3F, 0x0F,  // 178:13201
-  0x33, 0xD0, 0x3A, 0x0F,  // 179:13264
-  0x34, 0x0A, 0x48, 0x16,  // 180:13322
-  0x34, 0x52, 0x64, 0x17,  // 181:13394
-  0x34, 0xB6, 0x5A, 0x17,  // 182:13494
-  0x35, 0x10, 0x22, 0x0B,  // 183:13584
-  0x35, 0x32, 0x41, 0x16,  // 184:13618
-  0x35, 0x73, 0x3A, 0x0F,  // 185:13683
-  0x35, 0xAD, 0x49, 0x11,  // 186:13741
-  0x35, 0xF6, 0x54, 0x13,  // 187:13814
-  0x36, 0x4A, 0x86, 0x1D,  // 188:13898
-  0x36, 0xD0, 0x87, 0x1D,  // 189:14032
-  0x37, 0x57, 0x86, 0x1D,  // 190:14167
-  0x37, 0xDD, 0x3B, 0x0F,  // 191:14301
-  0x38, 0x18, 0x78, 0x19,  // 192:14360
-  0x38, 0x90, 0x78, 0x19,  // 193:14480
-  0x39, 0x08, 0x78, 0x19,  // 194:14600
-  0x39, 0x80, 0x78, 0x19,  // 195:14720
-  0x39, 0xF8, 0x78, 0x19,  // 196:14840
-  0x3A, 0x70, 0x78, 0x19,  // 197:14960
-  0x3A, 0xE8, 0xA0, 0x21,  // 198:15080
-  0x3B, 0x88, 0x73, 0x19,  // 199:15240
-  0x3B, 0xFB, 0x5F, 0x14,  // 200:15355
-  0x3C, 0x5A, 0x5F, 0x14,  // 201:15450
-  0x3C, 0xB9, 0x5F, 0x14,  // 202:15545
-  0x3D, 0x18, 0x5F, 0x14,  // 203:15640
-  0x3D, 0x77, 0x24, 0x0A,  // 204:15735
-  0x3D, 0x9B, 0x2E, 0x0A,  // 205:15771
-  0x3D, 0xC9, 0x2E, 0x0A,  // 206:15817
-  0x3D, 0xF7, 0x2E, 0x0A,  // 207:15863
-  0x3E, 0x25, 0x7C, 0x1B,  // 208:15909
-  0x3E, 0xA1, 0x78, 0x1B,  // 209:16033
-  0x3F, 0x19, 0x81, 0x1C,  // 210:16153
-  0x3F, 0x9A, 0x81, 0x1C,  // 211:16282
-  0x40, 0x1B, 0x81, 0x1C,  // 212:16411
-  0x40, 0x9C, 0x81, 0x1C,  // 213:16540
-  0x41, 0x1D, 0x81, 0x1C,  // 214:16669
-  0x41, 0x9E, 0x7D, 0x1D,  // 215:16798
-  0x42, 0x1B, 0x81, 0x1C,  // 216:16923
-  0x42, 0x9C, 0x6D, 0x19,  // 217:17052
-  0x43, 0x09, 0x6D, 0x19,  // 218:17161
-  0x43, 0x76, 0x6D, 0x19,  // 219:17270
-  0x43, 0xE3, 0x6D, 0x19,  // 220:17379
-  0x44, 0x50, 0x6B, 0x16,  // 221:17488
-  0x44, 0xBB, 0x63, 0x14,  // 222:17595
-  0x45, 0x1E, 0x69, 0x16,  // 223:17694
-  0x45, 0x87, 0x64, 0x14,  // 224:17799
-  0x45, 0xEB, 0x64, 0x14,  // 225:17899
-  0x46, 0x4F, 0x64, 0x14,  // 226:17999
-  0x46, 0xB3, 0x64, 0x14,  // 227:18099
-  0x47, 0x17, 0x64, 0x14,  // 228:18199
-  0x47, 0x7B, 0x64, 0x14,  // 229:18299
-  0x47, 0xDF, 0x91, 0x1F,  // 230:18399
-  0x48, 0x70, 0x50, 0x12,  // 231:18544
-  0x48, 0xC0, 0x5A, 0x14,  // 232:18624
-  0x49, 0x1A, 0x5A, 0x14,  // 233:18714
-  0x49, 0x74, 0x5A, 0x14,  // 234:18804
-  0x49, 0xCE, 0x5A, 0x14,  // 235:18894
-  0x4A, 0x28, 0x25, 0x0A,  // 236:18984
-  0x4A, 0x4D, 0x2F, 0x0A,  // 237:19021
-  0x4A, 0x7C, 0x2F, 0x0A,  // 238:19068
-  0x4A, 0xAB, 0x2F, 0x0A,  // 239:19115
-  0x4A, 0xDA, 0x63, 0x16,  // 240:19162
-  0x4B, 0x3D, 0x5F, 0x16,  // 241:19261
-  0x4B, 0x9C, 0x63, 0x16,  // 242:19356
-  0x4B, 0xFF, 0x63, 0x16,  // 243:19455
-  0x4C, 0x62, 0x63, 0x16,  // 244:19554
-  0x4C, 0xC5, 0x63, 0x16,  // 245:19653
-  0x4D, 0x28, 0x63, 0x16,  // 246:19752
-  0x4D, 0x8B, 0x77, 0x1D,  // 247:19851
-  0x4E, 0x02, 0x63, 0x16,  // 248:19970
-  0x4E, 0x65, 0x5F, 0x16,  // 249:20069
-  0x4E, 0xC4, 0x5F, 0x16,  // 250:20164
-  0x4F, 0x23, 0x5F, 0x16,  // 251:20259
-  0x4F, 0x82, 0x5F, 0x16,  // 252:20354
-  0x4F, 0xE1, 0x5D, 0x13,  // 253:20449
-  0x50, 0x3E, 0x68, 0x17,  // 254:20542
-  0x50, 0xA6, 0x5D, 0x13,  // 255:20646
-
-  // Font Data:
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x3F,0x1E,0x00,0xFC,0xFF,0x3F,0x1E,0x00,0xFC,0xFF,0x3F,0x1E,0x00,0xFC,0xFF,0x3F,0x1E, // 33
-  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0x00,0xFE,0x03, // 34
-  0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x18,0x00,0x00,0x0C,0x98,0x1F,0x00,0x00,0x0C,0xF8,0x07,0x00,0x00,0x0C,0xFF,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0xFF,0x18,0x00,0x00,0xF0,0x0F,0x18,0x00,0x00,0xFC,0x0C,0x18,0x00,0x00,0x0C,0x0C,0x18,0x18,0x00,0x00,0x0C,0x98,0x1F,0x00,0x00,0x0C,0xF8,0x07,0x00,0x00,0x8C,0x7F,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x80,0xFF,0x18,0x00,0x00,0xF0,0x0F,0x18,0x00,0x00,0xFC,0x0C,0x18,0x00,0x00,0x0C,0x0C,0x18,0x00,0x00,0x00,0x0C,0x18,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0C, // 35
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xC0,0x07,0x00,0x0E,0x00,0xF0,0x1F,0x00,0x0E,0x00,0xF8,0x3F,0x00,0x0E,0x00,0x78,0x7C,0x00,0x1C,0x00,0x3C,0xF0,0x00,0x1C,0x00,0x1C,0xE0,0x00,0x1C,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x1C,0xC0,0x03,0x1C,0x00,0x1C,0x80,0x07,0x1E,0x00,0x3C,0x00,0x0F,0x0F,0x00,0x38,0x00,0xFF,0x07,0x00,0x38,0x00,0xFE,0x03,0x00,0x70,0x00,0xF8,  // 36
-  0x00,0xC0,0x07,0x00,0x10,0x00,0xF0,0x1F,0x00,0x18,0x00,0xF8,0x3F,0x00,0x1C,0x00,0x3C,0x78,0x00,0x06,0x00,0x1C,0x70,0x80,0x03,0x00,0x1C,0x70,0xC0,0x01,0x00,0x1C,0x70,0xE0,0x00,0x00,0x3C,0x78,0x70,0x00,0x00,0xF8,0x3F,0x1C,0x00,0x00,0xF0,0x1F,0x0E,0x00,0x00,0xE0,0x07,0x07,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x70,0xF0,0x01,0x00,0x00,0x38,0xFC,0x07,0x00,0x00,0x1C,0xFE,0x0F,0x00,0x00,0x07,0x0F,0x1E,0x00,0x80,0x03,0x07,0x1C,0x00,0xC0,0x01,0x07,0x1C,0x00,0xE0,0x00,0x07,0x1C,0x00,0x38,0x00,0x0F,0x1E,0x00,0x1C,0x00,0xFE,0x0F,0x00,0x0C,0x00,0xFC,0x07,0x00,0x04,0x00,0xF8,0x01,  // 37
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0x80,0xFF,0x07,0x00,0x00,0xC0,0xFF,0x07,0x00,0x00,0xC0,0xC3,0x0F,0x00,0xE0,0xE3,0x00,0x0F,0x00,0xF0,0xFF,0x00,0x1E,0x00,0xF8,0x7F,0x00,0x1E,0x00,0xFC,0xFF,0x00,0x1C,0x00,0x3C,0xFC,0x03,0x1C,0x00,0x1C,0xF0,0x0F,0x1C,0x00,0x3C,0xF8,0x1F,0x1C,0x00,0xFC,0x3F,0x7F,0x1C,0x00,0xF8,0x1F,0xFC,0x0C,0x00,0xF0,0x0F,0xF8,0x0F,0x00,0xE0,0x03,0xE0,0x0F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x80,0xFF,0x1F,0x00,0x00,0x80,0xFF,0x1C,0x00,0x00,0x80,0x3F,0x18,0x00,0x00,0x80,0x07,0x10, // 38
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0x7E, // 39
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0xFC,0xFF,0x01,0x00,0x80,0xFF,0xFF,0x0F,0x00,0xC0,0xFF,0xFF,0x1F,0x00,0xF0,0x0F,0x80,0x3F,0x00,0xF8,0x00,0x00,0x38,0x00,0x3C,0x00,0x00,0x20,0x00,0x1E, // 40
-  0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x20,0x00,0xF0,0x00,0x00,0x38,0x00,0xE0,0x0F,0x80,0x3F,0x00,0x80,0xFF,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xE0,0x3F,  // 41
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x0C, // 42
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 43
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x3E, // 44
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E, // 45
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1E, // 46
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFF,0x03,0x00,0x00,0xE0,0x7F,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x80,0xFF,0x01,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x0C, // 47
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x7F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x0C, // 48
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x1C,0x00,0x70,0x00,0x00,0x1C,0x00,0x38,0x00,0x00,0x1C,0x00,0x38,0x00,0x00,0x1C,0x00,0x38,0x00,0x00,0x1C,0x00,0xF8,0xFF,0xFF,0x1F,0x00,0xF8,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,  // 49
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x70,0x00,0x80,0x1F,0x00,0x38,0x00,0xC0,0x1F,0x00,0x38,0x00,0xE0,0x1F,0x00,0x1C,0x00,0xF0,0x1D,0x00,0x1C,0x00,0x78,0x1C,0x00,0x1C,0x00,0x3C,0x1C,0x00,0x1C,0x00,0x1E,0x1C,0x00,0x1C,0x00,0x0F,0x1C,0x00,0x1C,0x80,0x07,0x1C,0x00,0x3C,0xC0,0x03,0x1C,0x00,0x78,0xF0,0x01,0x1C,0x00,0xF8,0xFF,0x00,0x1C,0x00,0xF0,0x7F,0x00,0x1C,0x00,0xE0,0x3F,0x00,0x1C,0x00,0xC0,0x0F,0x00,0x1C, // 50
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xE0,0x03,0x1C,0x00,0x3C,0xE0,0x03,0x1E,0x00,0x7C,0xF8,0x03,0x1E,0x00,0xF8,0x3F,0x0F,0x0F,0x00,0xF8,0x3F,0xFF,0x0F,0x00,0xF0,0x1F,0xFE,0x07,0x00,0xC0,0x07,0xFC,0x03,0x00,0x00,0x00,0xF8,  // 51
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0xF0,0x1C,0x00,0x00,0x00,0x7C,0x1C,0x00,0x00,0x00,0x1E,0x1C,0x00,0x00,0x80,0x0F,0x1C,0x00,0x00,0xC0,0x03,0x1C,0x00,0x00,0xF0,0x01,0x1C,0x00,0x00,0x78,0x00,0x1C,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C, // 52
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x7F,0x00,0x0E,0x00,0xFC,0x7F,0x00,0x0E,0x00,0xFC,0x7F,0x00,0x1C,0x00,0x1C,0x70,0x00,0x1C,0x00,0x1C,0x70,0x00,0x1C,0x00,0x1C,0x70,0x00,0x1C,0x00,0x1C,0x70,0x00,0x1C,0x00,0x1C,0xF0,0x00,0x1C,0x00,0x1C,0xE0,0x00,0x1E,0x00,0x1C,0xE0,0x01,0x0F,0x00,0x1C,0xC0,0x83,0x0F,0x00,0x1C,0xC0,0xFF,0x07,0x00,0x1C,0x80,0xFF,0x07,0x00,0x1C,0x00,0xFF,0x03,0x00,0x00,0x00,0xFC,  // 53
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0xC0,0xFF,0xFF,0x01,0x00,0xE0,0xFF,0xFF,0x07,0x00,0xF0,0x87,0xC3,0x07,0x00,0xF0,0xC0,0x01,0x0F,0x00,0x78,0xE0,0x00,0x0E,0x00,0x38,0x60,0x00,0x1C,0x00,0x3C,0x70,0x00,0x1C,0x00,0x1C,0x70,0x00,0x1C,0x00,0x1C,0x70,0x00,0x1C,0x00,0x1C,0x70,0x00,0x1C,0x00,0x1C,0xF0,0x00,0x1E,0x00,0x1C,0xF0,0x00,0x0E,0x00,0x1C,0xE0,0x83,0x0F,0x00,0x1C,0xE0,0xFF,0x07,0x00,0x38,0xC0,0xFF,0x03,0x00,0x38,0x80,0xFF,0x01,0x00,0x00,0x00,0x7E,  // 54
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x80,0x1F,0x00,0x1C,0x00,0xE0,0x1F,0x00,0x1C,0x00,0xF8,0x1F,0x00,0x1C,0x00,0xFE,0x07,0x00,0x1C,0x00,0x7F,0x00,0x00,0x1C,0xC0,0x1F,0x00,0x00,0x1C,0xF0,0x03,0x00,0x00,0x1C,0xF8,0x00,0x00,0x00,0x1C,0x3E,0x00,0x00,0x00,0x9C,0x1F,0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x00,0xFC,0x01,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x3C,  // 55
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x01,0x00,0xC0,0x07,0xFE,0x03,0x00,0xE0,0x0F,0xFF,0x07,0x00,0xF0,0x9F,0xFF,0x0F,0x00,0xF8,0xBF,0x87,0x0F,0x00,0x78,0xFC,0x01,0x1E,0x00,0x3C,0xF8,0x00,0x1E,0x00,0x1C,0xF0,0x00,0x1C,0x00,0x1C,0xF0,0x01,0x1C,0x00,0x1C,0xE0,0x01,0x1C,0x00,0x1C,0xE0,0x03,0x1C,0x00,0x3C,0xF0,0x03,0x1C,0x00,0x7C,0xBC,0x07,0x0E,0x00,0xF8,0x9F,0x0F,0x0F,0x00,0xF8,0x1F,0xFF,0x0F,0x00,0xF0,0x07,0xFE,0x07,0x00,0xE0,0x03,0xFC,0x03,0x00,0x00,0x00,0xF8,  // 56
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xC0,0xFF,0x00,0x0E,0x00,0xE0,0xFF,0x01,0x0E,0x00,0xF0,0xFF,0x03,0x1C,0x00,0xF8,0xE0,0x03,0x1C,0x00,0x38,0x80,0x07,0x1C,0x00,0x1C,0x80,0x07,0x1C,0x00,0x1C,0x00,0x07,0x1C,0x00,0x1C,0x00,0x07,0x1C,0x00,0x1C,0x00,0x07,0x1E,0x00,0x1C,0x00,0x03,0x0E,0x00,0x3C,0x80,0x03,0x0F,0x00,0x78,0x80,0x81,0x07,0x00,0xF8,0xE1,0xF0,0x07,0x00,0xF0,0xFF,0xFF,0x03,0x00,0xE0,0xFF,0xFF,0x00,0x00,0x80,0xFF,0x3F,0x00,0x00,0x00,0xFC,0x07,  // 57
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x1E,0x00,0x00,0x1E,0x00,0x1E,0x00,0x00,0x1E,0x00,0x1E,0x00,0x00,0x1E,0x00,0x1E, // 58
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x1E,0x00,0x00,0x1E,0x00,0x1E,0x00,0x00,0x1E,0x00,0x3E,0x00,0x00,0x1E,0x00,0x3E, // 59
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0xE0,0xE0,0x00,0x00,0x00,0xE0,0xE0,0x00,0x00,0x00,0x70,0xC0,0x01,0x00,0x00,0x70,0xC0,0x01,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x07,0x00,0x1C, // 60
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x1C,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x38,0x80,0x03,0x00,0x00,0x70,0xC0,0x01,0x00,0x00,0x70,0xC0,0x01,0x00,0x00,0xE0,0xE0,0x00,0x00,0x00,0xE0,0xE0,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0xC0,0x71,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0x80,0x3B,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x04,  // 62
-  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x78,0x1C,0x00,0x1C,0x00,0x7E,0x1C,0x00,0x1C,0x80,0x7F,0x1C,0x00,0x1C,0xC0,0x7F,0x1C,0x00,0x3C,0xF0,0x03,0x00,0x00,0x7C,0xFC,0x00,0x00,0x00,0xF8,0x7F,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x07,  // 63
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x60,0x00,0x00,0x80,0x01,0x20,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x01,0x60,0x00,0x00,0x80,0x01,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 64
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xE8,0xFF,0xFF,0xFF,0x05,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xA0,0xFF,0xFF,0x7F,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0x40,0xFF,0xFF,0xBF,0x00,0x80,0xFE,0xFF,0x5F,0x00,0x00,0xF9,0xFF,0x27,0x00,0x00,0xE6,0xFF,0x19,0x00,0x00,0x0C,0x3F,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 65
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xE8,0xFF,0xFF,0xFF,0x05,0xF0,0xFF,0xFF,0xFF,0x03,0xD0,0xFF,0xFF,0xFF,0x02,0xF0,0xFF,0xFF,0xFF,0x03,0xA0,0xFF,0xFF,0x7F,0x01,0x40,0xFF,0xFF,0xBF,0x00,0x40,0xFC,0xFF,0x8F,0x00,0x80,0xF8,0xFF,0x47,0x00,0x00,0xC1,0xFF,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 66
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xE8,0xFF,0xFF,0xFF,0x05,0xD0,0xFF,0xFF,0xFF,0x02,0xD0,0xFF,0xFF,0xFF,0x02,0xB0,0xFF,0xFF,0x7F,0x03,0x20,0xFE,0xFF,0x1F,0x01,0x40,0xFC,0xFF,0x8F,0x00,0x40,0xE0,0xFF,0x81,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 67
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xE8,0xFF,0xFF,0xFF,0x05,0xE8,0xFF,0xFF,0xFF,0x05,0xD0,0xFF,0xFF,0xFF,0x02,0x10,0xFF,0xFF,0x3F,0x02,0x30,0xFC,0xFF,0x0F,0x03,0x20,0xE0,0xFF,0x01,0x01,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 68
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xE8,0xFF,0xFF,0xFF,0x05,0xC8,0xFF,0xFF,0xFF,0x04,0x88,0xFF,0xFF,0x7F,0x04,0x10,0xFC,0xFF,0x0F,0x02,0x10,0xC0,0xFF,0x00,0x02,0x30,0x00,0x00,0x00,0x03,0x20,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 69
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xC8,0xFF,0xFF,0xFF,0x04,0x08,0xFC,0xFF,0x0F,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x30,0x00,0x00,0x00,0x03,0x20,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 70
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x30,0x00,0x00,0x00,0x03,0x20,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 71
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0x00,0x00,0xC0,0x07,0x18,0x00,0x00,0x00,0x06,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x30,0x00,0x00,0x00,0x03,0x20,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 72
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0x0F,0x00,0xFC,0x03,0xF8,0x01,0x00,0xE0,0x07,0x38,0x00,0x00,0x00,0x07,0x18,0x00,0x00,0x00,0x06,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x30,0x00,0x00,0x00,0x03,0x20,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 73
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0x3F,0x00,0xFF,0x01,0xF0,0x03,0x00,0xF0,0x03,0xF0,0x00,0x00,0xC0,0x03,0x70,0x00,0x00,0x80,0x03,0x38,0x00,0x00,0x00,0x07,0x18,0x00,0x00,0x00,0x06,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x01,0x60,0x00,0x00,0x80,0x01,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 74
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0x3F,0x00,0xFF,0x00,0xE0,0x07,0x00,0xF8,0x01,0xE0,0x01,0x00,0xE0,0x01,0xF0,0x00,0x00,0xC0,0x03,0x70,0x00,0x00,0x80,0x03,0x30,0x00,0x00,0x00,0x03,0x18,0x00,0x00,0x00,0x06,0x18,0x00,0x00,0x00,0x06,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x01,0x60,0x00,0x00,0x80,0x01,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 75
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0x7F,0x80,0x3F,0x00,0x80,0x0F,0x00,0x7C,0x00,0xC0,0x03,0x00,0xF0,0x00,0xE0,0x01,0x00,0xE0,0x01,0x60,0x00,0x00,0x80,0x01,0x30,0x00,0x00,0x00,0x03,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x18,0x00,0x00,0x00,0x06,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x01,0x60,0x00,0x00,0x80,0x01,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 76
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x7C,0x80,0x0F,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x03,0x00,0x30,0x00,0x80,0x01,0x00,0x60,0x00,0xC0,0x00,0x00,0xC0,0x00,0x60,0x00,0x00,0x80,0x01,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x30,0x00,0x00,0x00,0x03,0x20,0x00,0x00,0x00,0x01,0x60,0x00,0x00,0x80,0x01,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F,  // 77
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x60,0x00,0x00,0x80,0x01,0x20,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x30,0x00,0x00,0x00,0x03,0x20,0x00,0x00,0x00,0x01,0x60,0x00,0x00,0x80,0x01,0xC0,0x00,0x00,0xC0,0x00,0x80,0x01,0x00,0x60,0x00,0x00,0x03,0x00,0x30,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x7C,0x80,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x80,0x7F,  // 78
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x18,0x00,0x06,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0xC0,0x00,0x00,0xC0,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x18,0x00,0x00,0x00,0x06,0x10,0x00,0x00,0x00,0x02,0x30,0x00,0x00,0x00,0x03,0x70,0x00,0x00,0x80,0x03,0xE0,0x00,0x00,0xC0,0x01,0xC0,0x01,0x00,0xE0,0x00,0xC0,0x03,0x00,0xF0,0x00,0x80,0x0F,0x00,0x7C,0x00,0x00,0x7F,0x80,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x80,0x7F, // 79
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x18,0x00,0x04,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0xC0,0x00,0x00,0xC0,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x18,0x00,0x00,0x00,0x06,0x18,0x00,0x00,0x00,0x06,0x30,0x00,0x00,0x00,0x03,0x70,0x00,0x00,0x80,0x03,0xF0,0x00,0x00,0xC0,0x03,0xE0,0x01,0x00,0xE0,0x01,0xC0,0x07,0x00,0xF8,0x00,0xC0,0x7F,0x00,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x80,0x7F, // 80
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x18,0x00,0x04,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0xC0,0x00,0x00,0xC0,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x18,0x00,0x00,0x00,0x06,0x38,0x00,0x00,0x00,0x07,0x70,0x00,0x00,0x80,0x03,0xF0,0x01,0x00,0xE0,0x03,0xF0,0x07,0x00,0xF8,0x03,0xE0,0x3F,0x00,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x80,0x7F, // 81
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x18,0x00,0x00,0x00,0x06,0x38,0x00,0x00,0x00,0x07,0xF0,0x00,0x00,0xC0,0x03,0xF0,0x0F,0x00,0xFC,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 82
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x18,0x00,0x00,0x00,0x06,0xF8,0x00,0x00,0xC0,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 83
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0x08,0x00,0x00,0x00,0x04,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 84
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x08,0x00,0x00,0x00,0x04,0x08,0xFC,0xFF,0x0F,0x04,0xC8,0xFF,0xFF,0xFF,0x04,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 85
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x30,0x00,0x00,0x00,0x03,0x10,0xC0,0xFF,0x00,0x02,0x10,0xFC,0xFF,0x0F,0x02,0x88,0xFF,0xFF,0x7F,0x04,0xC8,0xFF,0xFF,0xFF,0x04,0xE8,0xFF,0xFF,0xFF,0x05,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 86
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0xF0,0xFF,0x01,0x01,0x30,0xFC,0xFF,0x0F,0x03,0x10,0xFF,0xFF,0x3F,0x02,0xD0,0xFF,0xFF,0xFF,0x02,0xE8,0xFF,0xFF,0xFF,0x05,0xE8,0xFF,0xFF,0xFF,0x05,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 87
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0xE0,0xFF,0x81,0x00,0x40,0xFC,0xFF,0x8F,0x00,0x20,0xFE,0xFF,0x1F,0x01,0xB0,0xFF,0xFF,0x7F,0x03,0xD0,0xFF,0xFF,0xFF,0x02,0xD0,0xFF,0xFF,0xFF,0x02,0xE8,0xFF,0xFF,0xFF,0x05,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 88
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0xC1,0xFF,0x20,0x00,0x80,0xF8,0xFF,0x47,0x00,0x40,0xFC,0xFF,0x8F,0x00,0x40,0xFF,0xFF,0xBF,0x00,0xA0,0xFF,0xFF,0x7F,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xD0,0xFF,0xFF,0xFF,0x02,0xF0,0xFF,0xFF,0xFF,0x03,0xE8,0xFF,0xFF,0xFF,0x05,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 89
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x3F,0x0C,0x00,0x00,0xE6,0xFF,0x19,0x00,0x00,0xF9,0xFF,0x27,0x00,0x80,0xFE,0xFF,0x5F,0x00,0x40,0xFF,0xFF,0xBF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xA0,0xFF,0xFF,0x7F,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE8,0xFF,0xFF,0xFF,0x05,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF8,0xFF,0xFF,0xFF,0x07,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x3F, // 90
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E, // 91
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x38,  // 92
-  0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,  // 93
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0xF0,0x03,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x10,  // 94
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x20,  // 96
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x06,0x00,0x18,0x00,0x00,0x08,0x00,0x04,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x80,0x7F, // 97
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x01,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x80,0x01,0x00,0x60,0x00,0x00,0x03,0x00,0x30,0x00,0x00,0x0F,0x00,0x3C,0x00,0x00,0x7C,0x80,0x0F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F, // 98
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x01,0x60,0x00,0x00,0x80,0x01,0xC0,0x00,0x00,0xC0,0x00,0xC0,0x01,0x00,0xE0,0x00,0x80,0x07,0x00,0x78,0x00,0x00,0x7F,0x80,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F,  // 99
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x20,0x00,0x00,0x00,0x01,0x60,0x00,0x00,0x80,0x01,0xE0,0x00,0x00,0xC0,0x01,0xC0,0x07,0x00,0xF8,0x00,0xC0,0x3F,0x00,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F,  // 100
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x70,0x00,0x00,0x80,0x03,0xE0,0x01,0x00,0xE0,0x01,0xE0,0x0F,0x00,0xFC,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 101
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0xF0,0x01,0x00,0xE0,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 102
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 103
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 104
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 105
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 106
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 107
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 108
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xC0,0xFF, // 109
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x80,0x7F,  // 110
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x00,0x0C, // 111
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0x00,0x3F, // 112
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xC0,0xFF,0xFF,0xFF,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x00,0x3F, // 113
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0x80,0xFF,0xFF,0x7F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0x03, // 114
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xE0,0xFF,0xFF,0xFF,0x01,0x00,0xFE,0xFF,0x1F,  // 115
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0xFF,0xFF,0xFF,0x03,  // 116
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xE0,0xFF,0xFF,0xFF,0x01,0xF0,0xFF,0xFF,0xFF,0x03,0xF0,0x03,0x00,0xF0,0x03,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,  // 117
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0xFF,0xFF,0xFF,0x00,0xE0,0xFF,0xFF,0xFF,0x00,0xE0,0x3F,0x00,0xFF,0x01,0xE0,0x03,0x00,0xF0,0x01,0x70,0x00,0x00,0x80,0x03,0x30,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,  // 118
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFF,0xFF,0x3F,0x00,0x80,0xFF,0xFF,0x7F,0x00,0xC0,0x3F,0x00,0xFF,0x00,0xC0,0x07,0x00,0xF8,0x00,0xE0,0x00,0x00,0xC0,0x01,0x60,0x00,0x00,0x80,0x01,0x20,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02, // 119
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0x7F,0x80,0x3F,0x00,0x80,0x07,0x00,0x78,0x00,0xC0,0x01,0x00,0xE0,0x00,0xC0,0x00,0x00,0xC0,0x00,0x60,0x00,0x00,0x80,0x01,0x20,0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02, // 120
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x7C,0x80,0x0F,0x00,0x00,0x0F,0x00,0x3C,0x00,0x00,0x03,0x00,0x30,0x00,0x80,0x01,0x00,0x60,0x00,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x80,0x00,0x20,0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,  // 121
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x70,0x80,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x00,0x02,0x00,0x10,0x00,0x00,0x01,0x00,0x20,0x00,0x80,0x00,0x00,0x40,0x00,0x40,0x00,0x00,0x80,0x00,0x40,0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,0x01,0x20,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x00,0x02,  // 122
-  0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0xF0,0x83,0x0F,0x3E,0x00,0xF8,0xFF,0xFD,0x3F,0x00,0xFC,0xFF,0xF8,0x3F,0x00,0x1E,0x7E,0xF0,0x03,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,  // 123
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,  // 124
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x9C,0x7F,0xF0,0x0F,0x00,0xFC,0xFF,0xF8,0x3F,0x00,0xF8,0xFF,0xFD,0x3F,0x00,0xE0,0x80,0x0F,0x38,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,  // 125
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x03,  // 126
-  0x00,0x00,0x60,0x0C,0x00,0x00,0x00,0x60,0x0C,0x00,0x00,0x00,0x60,0x0C,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xFE,0xFF,0x01,0x00,0x00,0xFF,0xFF,0x07,0x00,0x80,0x67,0xCC,0x07,0x00,0xC0,0x61,0x0C,0x0E,0x00,0xC0,0x60,0x0C,0x1C,0x00,0x60,0x60,0x0C,0x1C,0x00,0x60,0x60,0x0C,0x18,0x00,0x60,0x60,0x0C,0x18,0x00,0x60,0x60,0x0C,0x18,0x00,0x60,0x60,0x00,0x18,0x00,0xE0,0x00,0x00,0x18,0x00,0xC0,0x00,0x00,0x0E,0x00,0xC0,0x0F,0xC0,0x0F,0x00,0xC0,0x0F,0xC0,0x0F,  // 128
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x00,0x80,0x07,  // 129
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x08, // 130
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFF,0x3F,0x00,0x00,0x1E,0xFF,0x3F,0x00,0x00,0x1E,0xFF,0x3F,0x00,0x00,0x1E,0xFF,0x3F, // 161
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0x0F,0xF8,0x01,0x00,0x80,0x03,0xE0,0x01,0x00,0xC0,0x03,0xC0,0x03,0x00,0xC0,0x01,0x80,0x03,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xC0,0x01,0x80,0x03,0x00,0xC0,0x01,0x80,0x03,0x00,0xC0,0x01,0x80,0x03,0x00,0x80,0x03,0xC0,0x01,0x00,0x80,0x03,0xC0,0x01, // 162
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0xC0,0x01,0x1E,0x00,0x00,0xC0,0x01,0x1E,0x00,0x00,0xC0,0x81,0x1F,0x00,0xC0,0xFF,0xFF,0x1F,0x00,0xE0,0xFF,0xFF,0x1D,0x00,0xF8,0xFF,0xFF,0x1C,0x00,0xF8,0xFF,0x3F,0x1C,0x00,0x3C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x38,0x00,0x00,0x1C, // 163
-  0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x01,0x00,0xC0,0x01,0x80,0x03,0x00,0x80,0xE3,0xC7,0x01,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0x3E,0x7C,0x00,0x00,0x00,0x0E,0x70,0x00,0x00,0x00,0x0F,0xF0,0x00,0x00,0x00,0x07,0xE0,0x00,0x00,0x00,0x07,0xE0,0x00,0x00,0x00,0x07,0xE0,0x00,0x00,0x00,0x07,0xE0,0x00,0x00,0x00,0x0F,0xF0,0x00,0x00,0x00,0x0E,0x70,0x00,0x00,0x00,0x3E,0x7C,0x00,0x00,0x00,0xFE,0x7F,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x80,0xE3,0xC7,0x01,0x00,0xC0,0x01,0x80,0x03,0x00,0x80,0x00,0x00,0x01, // 164
-  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0xFC,0x80,0x31,0x00,0x00,0xFC,0x81,0x31,0x00,0x00,0xF0,0x87,0x31,0x00,0x00,0xE0,0x9F,0x31,0x00,0x00,0x80,0xBF,0x31,0x00,0x00,0x00,0xFF,0xFF,0x1F,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x1F,0x00,0x00,0xBC,0x31,0x00,0x00,0x00,0x9F,0x31,0x00,0x00,0x80,0x87,0x31,0x00,0x00,0xC0,0x83,0x31,0x00,0x00,0xF0,0x81,0x31,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x04, // 165
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x3F,0xE0,0x3F,0x00,0xFE,0x3F,0xE0,0x3F,0x00,0xFE,0x3F,0xE0,0x3F,  // 166
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x83,0x0F,0x00,0x00,0xF0,0xCF,0x3F,0x00,0x00,0xF0,0xFF,0x7F,0x00,0x00,0xF8,0xFF,0x7F,0x00,0x00,0x38,0x3E,0xF8,0x00,0x00,0x3C,0x3C,0xF0,0x01,0x00,0x1C,0x7C,0xE0,0x01,0x00,0x1C,0xF8,0xE0,0x03,0x00,0x1C,0xF0,0xC0,0x07,0x00,0x1C,0xF0,0x81,0x07,0x00,0x1C,0xE0,0x83,0x0F,0x00,0x1C,0xE0,0xFF,0x3F,0x00,0x38,0xC0,0xFF,0x3E,0x00,0x38,0x80,0x7F,0x3E,0x00,0x00,0x00,0x1E,0x38, // 167
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38, // 168
-  0x0E,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x1C,0x08,0x00,0x0E,0x00,0x0C,0x0E,0x30,0x12,0x00,0x0C,0x0C,0x70,0x0A,0x00,0x1C,0x1C,0xD0,0x0C,0x00,0x0C,0x08,0x70,0x10,0x70,0x0C,0x14,0x00,0x0C,0x28,0x04,0x0C,0x00,0x0C,0x28,0x0C,0x0C,0x70,0x04,0x70,0x0C,0x04,0x00,0x0E,0x10,0x0C,0x88,0x50,0x0E,0x70,0x0C,0xC0,0x73,0x0C,0x70,0x04,0x0E,0x30,0x0C,0x20,0x0C,0x0A,0x72,0x00,0x70,0x0C,0x06,0x70,0x04,0x60,0x08,0xCE,0x53,0x0A,0x00,0x1C,0x04,0xB0,0x12,0x70,0x0C,0x0C,0x70,0x0A,0x38,0x0E,0x1C,0x00,0x06,0x50,0x00,0x0C,0x70,0x0C,0x70,0x0C,0x04,0x90,0x1C,0x60,0x10,0x1C,0x60,0x0C,0x10,0x0C,0x0C,0xA0,0x0C,0x00,0x0C,0x0C,0x60,0x0A,0x00,0x0C,0x14,0x00,0x0C,0x00,0x0C,0x04,0x00,0x14,0x00,0x1C,0x1C,0x00,0x00,0x00,0x0C,0x0C, // 169
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x8C,0x1F,0x00,0x00,0x00,0x86,0x3F,0x00,0x00,0x00,0xC6,0x31,0x00,0x00,0x00,0xC6,0x30,0x00,0x00,0x00,0xC6,0x10,0x00,0x00,0x00,0xCE,0x18,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0xF8,0x3F,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x30, // 170
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x70,0x08,0x07,0x00,0x00,0x20,0x1C,0x02,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0x70,0x00,0x07,0x00,0x00,0x20,0x00,0x02,  // 171
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0xE0,0xFF,  // 172
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E, // 173
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0x0F,0x78,0x00,0x00,0xC0,0x03,0xE0,0x01,0x00,0xE0,0x00,0x80,0x03,0x00,0x60,0x00,0x00,0x03,0x00,0x30,0x00,0x00,0x06,0x00,0x38,0x00,0x00,0x0E,0x00,0x18,0x00,0x00,0x0C,0x00,0x18,0xFF,0x7F,0x0C,0x00,0x0C,0xFF,0x7F,0x18,0x00,0x0C,0x83,0x01,0x18,0x00,0x0C,0x83,0x01,0x18,0x00,0x0C,0x83,0x03,0x18,0x00,0x0C,0x83,0x07,0x18,0x00,0x0C,0xC7,0x0F,0x18,0x00,0x0C,0x7E,0x3C,0x18,0x00,0x18,0x3C,0x78,0x0C,0x00,0x18,0x00,0x60,0x0C,0x00,0x38,0x00,0x40,0x0E,0x00,0x30,0x00,0x00,0x06,0x00,0x60,0x00,0x00,0x03,0x00,0xE0,0x00,0x80,0x03,0x00,0xC0,0x03,0xE0,0x01,0x00,0x00,0x0F,0x78,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF0,0x07,  // 174
-  0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x07, // 175
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0x0C,0x03,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x0C,0x03,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xF0,  // 176
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0xFE,0xFF,0x1C,0x00,0x00,0xFE,0xFF,0x1C,0x00,0x00,0xFE,0xFF,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C,0x00,0x00,0x80,0x03,0x1C, // 177
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x1C,0x00,0x00,0xC0,0x00,0x1E,0x00,0x00,0x60,0x00,0x1F,0x00,0x00,0x60,0x80,0x1B,0x00,0x00,0x60,0xC0,0x19,0x00,0x00,0x60,0xE0,0x18,0x00,0x00,0xE0,0x78,0x18,0x00,0x00,0xC0,0x3F,0x18,0x00,0x00,0xC0,0x1F,0x18,0x00,0x00,0x80,0x07,0x18, // 178
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0xC0,0x00,0x1C,0x00,0x00,0x60,0x30,0x18,0x00,0x00,0x60,0x30,0x18,0x00,0x00,0x60,0x30,0x18,0x00,0x00,0x60,0x30,0x18,0x00,0x00,0xE0,0x78,0x1C,0x00,0x00,0xE0,0xEF,0x0F,0x00,0x00,0xC0,0xCF,0x0F,0x00,0x00,0x80,0x87,0x07,  // 179
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x01,  // 180
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0xFE,0xFF,0x3F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,  // 181
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x07,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xF8,0x1F,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0xFC,0x3F,0x00,0x00,0x00,0xFC,0x7F,0x00,0x00,0x00,0xFC,0x7F,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x3F,0x00,0xFC,0xFF,0xFF,0x3F,0x00,0x0C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x3F,0x00,0xFC,0xFF,0xFF,0x3F,  // 182
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x0F,  // 183
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x20, // 184
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x18,0x00,0x00,0xC0,0x00,0x18,0x00,0x00,0xC0,0x00,0x18,0x00,0x00,0xC0,0xFF,0x1F,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,  // 185
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0x1C,0x1C,0x00,0x00,0x00,0x0E,0x38,0x00,0x00,0x00,0x06,0x30,0x00,0x00,0x00,0x06,0x30,0x00,0x00,0x00,0x06,0x30,0x00,0x00,0x00,0x0E,0x38,0x00,0x00,0x00,0x1C,0x1C,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xE0,0x03, // 186
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x07,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x20,0x1C,0x02,0x00,0x00,0x70,0x08,0x07,0x00,0x00,0xE0,0x80,0x03,0x00,0x00,0xC0,0xC1,0x01,0x00,0x00,0x80,0xE3,0x00,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x08,  // 187
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x18,0x00,0x00,0x18,0x00,0xF8,0xFF,0x07,0x0E,0x00,0xFC,0xFF,0x07,0x07,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x38,0xE0,0x00,0x00,0x00,0x0C,0xF0,0x00,0x00,0x00,0x07,0xDC,0x00,0x00,0x80,0x03,0xCE,0x00,0x00,0xC0,0x00,0xC7,0x00,0x00,0x70,0xC0,0xC1,0x00,0x00,0x38,0xE0,0xC0,0x00,0x00,0x0C,0xF0,0xFF,0x1F,0x00,0x04,0xF0,0xFF,0x1F,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0xC0,  // 188
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x10,0x00,0x18,0x00,0x00,0x18,0x00,0x18,0x00,0x00,0x0E,0x00,0xF8,0xFF,0x07,0x07,0x00,0xFC,0xFF,0x87,0x01,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x67,0x00,0x1C,0x00,0x80,0x63,0x00,0x1E,0x00,0xC0,0x30,0x00,0x1F,0x00,0x70,0x30,0x80,0x1B,0x00,0x38,0x30,0xC0,0x19,0x00,0x0C,0x30,0x60,0x18,0x00,0x04,0x30,0x70,0x18,0x00,0x00,0x60,0x3C,0x18,0x00,0x00,0xE0,0x0F,0x18,0x00,0x00,0x80,0x07,0x18, // 189
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x03,0x00,0x00,0x0C,0x06,0x06,0x00,0x00,0x0C,0x06,0x06,0x10,0x00,0x0C,0x06,0x06,0x18,0x00,0x0C,0x06,0x06,0x0E,0x00,0x0C,0x07,0x06,0x07,0x00,0x1C,0x0D,0x86,0x01,0x00,0xF8,0x1D,0xE3,0x00,0x00,0xF0,0xF8,0x73,0x00,0x00,0x00,0xF0,0x18,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x70,0xE0,0x00,0x00,0x00,0x38,0xF0,0x00,0x00,0x00,0x0C,0xDC,0x00,0x00,0x00,0x07,0xCE,0x00,0x00,0x80,0x03,0xC7,0x00,0x00,0xC0,0xC0,0xC1,0x00,0x00,0x70,0xE0,0xC0,0x00,0x00,0x38,0xF0,0xFF,0x1F,0x00,0x0C,0xF0,0xFF,0x1F,0x00,0x04,0x00,0xC0,0x00,0x00,0x00,0x00,0xC0,  // 190
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x80,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x8E,0xFF,0x00,0x00,0x00,0x8E,0x3F,0x00,0x00,0x00,0x8E,0x1F,0x00,0x00,0x00,0x8E,0x07, // 191
-  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xF0,0x3F,0x00,0x04,0x00,0xFE,0x39,0x00,0x0C,0xC0,0x7F,0x38,0x00,0x1C,0xF0,0x0F,0x38,0x00,0x3C,0xFC,0x01,0x38,0x00,0x78,0x7C,0x00,0x38,0x00,0xF0,0xFC,0x01,0x38,0x00,0xC0,0xFC,0x0F,0x38,0x00,0x80,0xF8,0x7F,0x38,0x00,0x00,0xC0,0xFF,0x39,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x10,  // 192
-  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0xFE,0x39,0x00,0x00,0xC0,0x7F,0x38,0x00,0x00,0xF0,0x0F,0x38,0x00,0x80,0xFC,0x01,0x38,0x00,0xC0,0x7C,0x00,0x38,0x00,0xF0,0xFC,0x01,0x38,0x00,0x78,0xFC,0x0F,0x38,0x00,0x3C,0xF8,0x7F,0x38,0x00,0x1C,0xC0,0xFF,0x39,0x00,0x0C,0x00,0xFE,0x3F,0x00,0x04,0x00,0xF0,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x10,  // 193
-  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xF0,0x3F,0x00,0x80,0x00,0xFE,0x39,0x00,0xE0,0xC0,0x7F,0x38,0x00,0xF0,0xF0,0x0F,0x38,0x00,0x7C,0xFC,0x01,0x38,0x00,0x1C,0x7C,0x00,0x38,0x00,0x0C,0xFC,0x01,0x38,0x00,0x3C,0xFC,0x0F,0x38,0x00,0x7C,0xF8,0x7F,0x38,0x00,0xF0,0xC0,0xFF,0x39,0x00,0xE0,0x00,0xFE,0x3F,0x00,0x80,0x00,0xF0,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x10,  // 194
-  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xC0,0x7F,0x00,0xC0,0x00,0xF0,0x3F,0x00,0xE0,0x00,0xFE,0x39,0x00,0x30,0xC0,0x7F,0x38,0x00,0x30,0xF0,0x0F,0x38,0x00,0x30,0xFC,0x01,0x38,0x00,0x60,0x7C,0x00,0x38,0x00,0x60,0xFC,0x01,0x38,0x00,0xC0,0xFC,0x0F,0x38,0x00,0xC0,0xF8,0x7F,0x38,0x00,0xC0,0xC0,0xFF,0x39,0x00,0x70,0x00,0xFE,0x3F,0x00,0x30,0x00,0xF0,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x10,  // 195
-  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xF0,0x3F,0x00,0xE0,0x00,0xFE,0x39,0x00,0xE0,0xC0,0x7F,0x38,0x00,0xE0,0xF0,0x0F,0x38,0x00,0x00,0xFC,0x01,0x38,0x00,0x00,0x7C,0x00,0x38,0x00,0x00,0xFC,0x01,0x38,0x00,0x00,0xFC,0x0F,0x38,0x00,0xE0,0xF8,0x7F,0x38,0x00,0xE0,0xC0,0xFF,0x39,0x00,0xE0,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x10,  // 196
-  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x00,0x00,0xFE,0x03,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xF0,0x3F,0x00,0x00,0x00,0xFE,0x39,0x00,0xF0,0xC0,0x7F,0x38,0x00,0xF8,0xF1,0x0F,0x38,0x00,0x9C,0xFF,0x01,0x38,0x00,0x0C,0x7F,0x00,0x38,0x00,0x0C,0xFF,0x01,0x38,0x00,0x9C,0xFF,0x0F,0x38,0x00,0xF8,0xF9,0x7F,0x38,0x00,0xF0,0xC0,0xFF,0x39,0x00,0x00,0x00,0xFE,0x3F,0x00,0x00,0x00,0xF0,0x7F,0x00,0x00,0x00,0xC0,0xFF,0x01,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x10,  // 197
-  0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF8,0x01,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x80,0x1F,0x00,0x00,0x00,0xC0,0x1F,0x00,0x00,0x00,0xF0,0x1F,0x00,0x00,0x00,0xFC,0x1C,0x00,0x00,0x00,0x3F,0x1C,0x00,0x00,0xC0,0x0F,0x1C,0x00,0x00,0xE0,0x07,0x1C,0x00,0x00,0xF8,0x01,0x1C,0x00,0x00,0x7C,0x00,0x1C,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,  // 198
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x01,0x00,0xE0,0xFF,0xFF,0x03,0x00,0xE0,0x07,0xF8,0x07,0x00,0xF0,0x01,0xC0,0x07,0x00,0xF8,0x00,0x80,0x0F,0x00,0x78,0x00,0x00,0x0F,0x00,0x38,0x00,0x00,0x1E,0x00,0x3C,0x00,0x00,0x1E,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x3C,0x00,0x1C,0x00,0x00,0x3C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x3C,0x00,0x00,0x1C,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x0E,0x00,0x70,0x00,0x00,0x07, // 199
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x04,0xFC,0xFF,0xFF,0x1F,0x0C,0x1C,0xC0,0x01,0x1C,0x1C,0x1C,0xC0,0x01,0x1C,0x3C,0x1C,0xC0,0x01,0x1C,0x78,0x1C,0xC0,0x01,0x1C,0xF0,0x1C,0xC0,0x01,0x1C,0xC0,0x1C,0xC0,0x01,0x1C,0x80,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C, // 200
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0x1C,0xC0,0x01,0x1C,0x80,0x1C,0xC0,0x01,0x1C,0xC0,0x1C,0xC0,0x01,0x1C,0xF0,0x1C,0xC0,0x01,0x1C,0x78,0x1C,0xC0,0x01,0x1C,0x3C,0x1C,0xC0,0x01,0x1C,0x1C,0x1C,0xC0,0x01,0x1C,0x0C,0x1C,0xC0,0x01,0x1C,0x04,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C, // 201
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x80,0xFC,0xFF,0xFF,0x1F,0xE0,0x1C,0xC0,0x01,0x1C,0xF0,0x1C,0xC0,0x01,0x1C,0x7C,0x1C,0xC0,0x01,0x1C,0x1C,0x1C,0xC0,0x01,0x1C,0x0C,0x1C,0xC0,0x01,0x1C,0x3C,0x1C,0xC0,0x01,0x1C,0x7C,0x1C,0xC0,0x01,0x1C,0xF0,0x1C,0xC0,0x01,0x1C,0xE0,0x1C,0xC0,0x01,0x1C,0x80,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C, // 202
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0xE0,0xFC,0xFF,0xFF,0x1F,0xE0,0x1C,0xC0,0x01,0x1C,0xE0,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0xE0,0x1C,0xC0,0x01,0x1C,0xE0,0x1C,0xC0,0x01,0x1C,0xE0,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C, // 203
-  0x04,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x3C,0xFC,0xFF,0xFF,0x1F,0x78,0xFC,0xFF,0xFF,0x1F,0xF0,0xFC,0xFF,0xFF,0x1F,0xC0,0xFC,0xFF,0xFF,0x1F,0x80,  // 204
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFC,0xFF,0xFF,0x1F,0xC0,0xFC,0xFF,0xFF,0x1F,0xF0,0xFC,0xFF,0xFF,0x1F,0x78,0xFC,0xFF,0xFF,0x1F,0x3C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,  // 205
-  0x80,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x7C,0xFC,0xFF,0xFF,0x1F,0x1C,0xFC,0xFF,0xFF,0x1F,0x0C,0xFC,0xFF,0xFF,0x1F,0x3C,0xFC,0xFF,0xFF,0x1F,0x7C,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0xE0,  // 206
-  0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0xE0,0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0xE0,  // 207
-  0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0x00,0xC0,0x01,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0xC0,0x01,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x3C,0x00,0x00,0x1E,0x00,0x3C,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0F,0x00,0xF8,0x00,0x00,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xF0,0x07,0xF8,0x03,0x00,0xE0,0xFF,0xFF,0x01,0x00,0xC0,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0xF8,0x0F,  // 208
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0x01,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0xC0,0xE0,0x0F,0x00,0x00,0xE0,0xC0,0x1F,0x00,0x00,0x30,0x00,0x7F,0x00,0x00,0x30,0x00,0xFE,0x00,0x00,0x30,0x00,0xF8,0x01,0x00,0x60,0x00,0xF0,0x07,0x00,0x60,0x00,0xC0,0x0F,0x00,0xC0,0x00,0x80,0x3F,0x00,0xC0,0x00,0x00,0x7E,0x00,0xC0,0x00,0x00,0xFC,0x01,0x70,0x00,0x00,0xF8,0x03,0x30,0x00,0x00,0xE0,0x0F,0x00,0x00,0x00,0xC0,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,  // 209
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0xF0,0x07,0xF0,0x03,0x00,0xF0,0x01,0xC0,0x07,0x00,0x78,0x00,0x00,0x0F,0x04,0x38,0x00,0x00,0x0E,0x0C,0x3C,0x00,0x00,0x1E,0x1C,0x1C,0x00,0x00,0x1C,0x3C,0x1C,0x00,0x00,0x1C,0x78,0x1C,0x00,0x00,0x1C,0xF0,0x1C,0x00,0x00,0x1C,0xC0,0x1C,0x00,0x00,0x1C,0x80,0x1C,0x00,0x00,0x1C,0x00,0x3C,0x00,0x00,0x1E,0x00,0x38,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xE0,0x07,0xF0,0x03,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0xF8,0x0F, // 210
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0xF0,0x07,0xF0,0x03,0x00,0xF0,0x01,0xC0,0x07,0x00,0x78,0x00,0x00,0x0F,0x00,0x38,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x1E,0x00,0x1C,0x00,0x00,0x1C,0x80,0x1C,0x00,0x00,0x1C,0xC0,0x1C,0x00,0x00,0x1C,0xF0,0x1C,0x00,0x00,0x1C,0x78,0x1C,0x00,0x00,0x1C,0x3C,0x1C,0x00,0x00,0x1C,0x1C,0x3C,0x00,0x00,0x1E,0x0C,0x38,0x00,0x00,0x0E,0x04,0x78,0x00,0x00,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xE0,0x07,0xF0,0x03,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0xF8,0x0F, // 211
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0xF0,0x07,0xF0,0x03,0x00,0xF0,0x01,0xC0,0x07,0x00,0x78,0x00,0x00,0x0F,0x80,0x38,0x00,0x00,0x0E,0xE0,0x3C,0x00,0x00,0x1E,0xF0,0x1C,0x00,0x00,0x1C,0x7C,0x1C,0x00,0x00,0x1C,0x1C,0x1C,0x00,0x00,0x1C,0x0C,0x1C,0x00,0x00,0x1C,0x3C,0x1C,0x00,0x00,0x1C,0x7C,0x1C,0x00,0x00,0x1C,0xF0,0x3C,0x00,0x00,0x1E,0xE0,0x38,0x00,0x00,0x0E,0x80,0x78,0x00,0x00,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xE0,0x07,0xF0,0x03,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0xF8,0x0F, // 212
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0xF0,0x07,0xF0,0x03,0x00,0xF0,0x01,0xC0,0x07,0xC0,0x78,0x00,0x00,0x0F,0xE0,0x38,0x00,0x00,0x0E,0x30,0x3C,0x00,0x00,0x1E,0x30,0x1C,0x00,0x00,0x1C,0x30,0x1C,0x00,0x00,0x1C,0x60,0x1C,0x00,0x00,0x1C,0x60,0x1C,0x00,0x00,0x1C,0xC0,0x1C,0x00,0x00,0x1C,0xC0,0x1C,0x00,0x00,0x1C,0xC0,0x3C,0x00,0x00,0x1E,0x70,0x38,0x00,0x00,0x0E,0x30,0x78,0x00,0x00,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xE0,0x07,0xF0,0x03,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0xF8,0x0F, // 213
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x80,0xFF,0xFF,0x00,0x00,0xE0,0xFF,0xFF,0x03,0x00,0xF0,0x07,0xF0,0x03,0x00,0xF0,0x01,0xC0,0x07,0x00,0x78,0x00,0x00,0x0F,0xE0,0x38,0x00,0x00,0x0E,0xE0,0x3C,0x00,0x00,0x1E,0xE0,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x1C,0xE0,0x1C,0x00,0x00,0x1C,0xE0,0x3C,0x00,0x00,0x1E,0xE0,0x38,0x00,0x00,0x0E,0x00,0x78,0x00,0x00,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xE0,0x07,0xF0,0x03,0x00,0xE0,0xFF,0xFF,0x03,0x00,0x80,0xFF,0xFF,0x00,0x00,0x00,0xFF,0x7F,0x00,0x00,0x00,0xF8,0x0F, // 214
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x1F,0x00,0x1F,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0xF8,0xE0,0x03,0x00,0x00,0xF0,0xF1,0x01,0x00,0x00,0xE0,0xFB,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xC0,0x7F,0x00,0x00,0x00,0xE0,0xFB,0x00,0x00,0x00,0xF0,0xF1,0x01,0x00,0x00,0xF8,0xE0,0x03,0x00,0x00,0x7C,0xC0,0x07,0x00,0x00,0x3E,0x80,0x0F,0x00,0x00,0x1F,0x00,0x1F,0x00,0x00,0x0E,0x00,0x0E,0x00,0x00,0x04,0x00,0x04, // 215
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x10,0x00,0x00,0xFF,0x7F,0x18,0x00,0x80,0xFF,0xFF,0x1E,0x00,0xE0,0xFF,0xFF,0x1F,0x00,0xE0,0x07,0xF0,0x07,0x00,0xF0,0x01,0xC0,0x07,0x00,0x78,0x00,0xF0,0x0F,0x00,0x38,0x00,0xF8,0x0E,0x00,0x3C,0x00,0x3C,0x1E,0x00,0x1C,0x00,0x1F,0x1C,0x00,0x1C,0x80,0x0F,0x1C,0x00,0x1C,0xC0,0x03,0x1C,0x00,0x1C,0xE0,0x01,0x1C,0x00,0x1C,0xF8,0x00,0x1C,0x00,0x1C,0x7C,0x00,0x1C,0x00,0x3C,0x1E,0x00,0x1E,0x00,0xB8,0x0F,0x00,0x0E,0x00,0xF8,0x07,0x00,0x0F,0x00,0xF0,0x01,0xC0,0x07,0x00,0xF0,0x07,0xF0,0x03,0x00,0xFC,0xFF,0xFF,0x03,0x00,0xBC,0xFF,0xFF,0x00,0x00,0x0C,0xFF,0x7F,0x00,0x00,0x04,0xF8,0x0F, // 216
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0xFC,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0x07,0x04,0x00,0x00,0xC0,0x0F,0x0C,0x00,0x00,0x00,0x0F,0x1C,0x00,0x00,0x00,0x1E,0x3C,0x00,0x00,0x00,0x1C,0x78,0x00,0x00,0x00,0x1C,0xF0,0x00,0x00,0x00,0x1C,0xC0,0x00,0x00,0x00,0x1C,0x80,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0xFC,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0x03,0x00,0xFC,0xFF,0x7F, // 217
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0xFC,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0x07,0x00,0x00,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x1E,0x80,0x00,0x00,0x00,0x1C,0xC0,0x00,0x00,0x00,0x1C,0xF0,0x00,0x00,0x00,0x1C,0x78,0x00,0x00,0x00,0x1C,0x3C,0x00,0x00,0x00,0x1C,0x1C,0x00,0x00,0x00,0x1C,0x0C,0x00,0x00,0x00,0x0E,0x04,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0xFC,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0x03,0x00,0xFC,0xFF,0x7F, // 218
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0xFC,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0x07,0x80,0x00,0x00,0xC0,0x0F,0xE0,0x00,0x00,0x00,0x0F,0xF0,0x00,0x00,0x00,0x1E,0x7C,0x00,0x00,0x00,0x1C,0x1C,0x00,0x00,0x00,0x1C,0x0C,0x00,0x00,0x00,0x1C,0x3C,0x00,0x00,0x00,0x1C,0x7C,0x00,0x00,0x00,0x1C,0xF0,0x00,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x0E,0x80,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0xFC,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0x03,0x00,0xFC,0xFF,0x7F, // 219
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x7F,0x00,0x00,0xFC,0xFF,0xFF,0x01,0x00,0xFC,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0x07,0x00,0x00,0x00,0xC0,0x0F,0xE0,0x00,0x00,0x00,0x0F,0xE0,0x00,0x00,0x00,0x1E,0xE0,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x1C,0xE0,0x00,0x00,0x00,0x0E,0xE0,0x00,0x00,0x00,0x0F,0x00,0x00,0x00,0x80,0x0F,0x00,0xFC,0xFF,0xFF,0x07,0x00,0xFC,0xFF,0xFF,0x03,0x00,0xFC,0xFF,0x7F, // 220
-  0x00,0x04,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x00,0xE0,0x1F,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x80,0x00,0xFC,0xFF,0x1F,0xC0,0x00,0xF0,0xFF,0x1F,0xF0,0x00,0xC0,0xFF,0x1F,0x78,0x00,0xF0,0xFF,0x1F,0x3C,0x00,0xFC,0x00,0x00,0x1C,0x00,0x3E,0x00,0x00,0x0C,0x80,0x1F,0x00,0x00,0x04,0xE0,0x07,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x04, // 221
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0x80,0x03,0xE0,0x00,0x00,0x80,0x03,0xE0,0x00,0x00,0x80,0x03,0xE0,0x00,0x00,0x80,0x03,0xE0,0x00,0x00,0x80,0x03,0xE0,0x00,0x00,0x80,0x03,0xF0,0x00,0x00,0x80,0x07,0x70,0x00,0x00,0x80,0x07,0x78,0x00,0x00,0x00,0x0F,0x3E,0x00,0x00,0x00,0xFF,0x3F,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xFE,0x0F,0x00,0x00,0x00,0xF8,0x03, // 222
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0x1F,0x00,0xF8,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0xFC,0xFF,0xFF,0x1F,0x00,0x1E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0xF0,0x00,0x0E,0x00,0x0E,0xFC,0x01,0x1E,0x00,0x1E,0xFE,0x03,0x1C,0x00,0xFC,0xFF,0x07,0x1C,0x00,0xFC,0xCF,0x0F,0x1C,0x00,0xF8,0x03,0x1F,0x1C,0x00,0xF0,0x00,0x3E,0x1E,0x00,0x00,0x00,0xFE,0x1F,0x00,0x00,0x00,0xFC,0x0F,0x00,0x00,0x00,0xF8,0x07,0x00,0x00,0x00,0xE0,0x03, // 223
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x38,0xF8,0x0F,0x00,0x01,0x1C,0xFC,0x1F,0x00,0x03,0x1C,0x1C,0x1E,0x00,0x07,0x0E,0x0C,0x1C,0x00,0x0F,0x0E,0x0E,0x1C,0x00,0x1E,0x0E,0x06,0x1C,0x00,0x3C,0x0E,0x06,0x0C,0x00,0x30,0x0E,0x06,0x0E,0x00,0x20,0x1E,0x06,0x07,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,  // 224
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x38,0xF8,0x0F,0x00,0x00,0x1C,0xFC,0x1F,0x00,0x00,0x1C,0x1C,0x1E,0x00,0x20,0x0E,0x0C,0x1C,0x00,0x30,0x0E,0x0E,0x1C,0x00,0x3C,0x0E,0x06,0x1C,0x00,0x1E,0x0E,0x06,0x0C,0x00,0x0F,0x0E,0x06,0x0E,0x00,0x07,0x1E,0x06,0x07,0x00,0x03,0xFE,0xFF,0x03,0x00,0x01,0xFC,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,  // 225
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x38,0xF8,0x0F,0x00,0x20,0x1C,0xFC,0x1F,0x00,0x38,0x1C,0x1C,0x1E,0x00,0x3C,0x0E,0x0C,0x1C,0x00,0x1F,0x0E,0x0E,0x1C,0x00,0x07,0x0E,0x06,0x1C,0x00,0x03,0x0E,0x06,0x0C,0x00,0x0F,0x0E,0x06,0x0E,0x00,0x1F,0x1E,0x06,0x07,0x00,0x3C,0xFE,0xFF,0x03,0x00,0x38,0xFC,0xFF,0x0F,0x00,0x20,0xFC,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,  // 226
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x38,0xF8,0x0F,0x00,0x30,0x1C,0xFC,0x1F,0x00,0x38,0x1C,0x1C,0x1E,0x00,0x0C,0x0E,0x0C,0x1C,0x00,0x0C,0x0E,0x0E,0x1C,0x00,0x0C,0x0E,0x06,0x1C,0x00,0x18,0x0E,0x06,0x0C,0x00,0x18,0x0E,0x06,0x0E,0x00,0x30,0x1E,0x06,0x07,0x00,0x30,0xFE,0xFF,0x03,0x00,0x30,0xFC,0xFF,0x0F,0x00,0x1C,0xFC,0xFF,0x1F,0x00,0x0C,0xF0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,  // 227
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x38,0xF8,0x0F,0x00,0x38,0x1C,0xFC,0x1F,0x00,0x38,0x1C,0x1C,0x1E,0x00,0x38,0x0E,0x0C,0x1C,0x00,0x00,0x0E,0x0E,0x1C,0x00,0x00,0x0E,0x06,0x1C,0x00,0x00,0x0E,0x06,0x0C,0x00,0x00,0x0E,0x06,0x0E,0x00,0x38,0x1E,0x06,0x07,0x00,0x38,0xFE,0xFF,0x03,0x00,0x38,0xFC,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,  // 228
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x38,0xF8,0x0F,0x00,0x00,0x1C,0xFC,0x1F,0x00,0x00,0x1C,0x1C,0x1E,0x00,0x0F,0x0E,0x0C,0x1C,0x80,0x1F,0x0E,0x0E,0x1C,0xC0,0x39,0x0E,0x06,0x1C,0xC0,0x30,0x0E,0x06,0x0C,0xC0,0x30,0x0E,0x06,0x0E,0xC0,0x39,0x1E,0x06,0x07,0x80,0x1F,0xFE,0xFF,0x03,0x00,0x0F,0xFC,0xFF,0x0F,0x00,0x00,0xFC,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0C,  // 229
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x03,0x00,0x00,0x00,0xF0,0x07,0x00,0x00,0x38,0xF8,0x0F,0x00,0x00,0x1C,0xFC,0x1F,0x00,0x00,0x1C,0x1C,0x1E,0x00,0x00,0x0E,0x0C,0x1C,0x00,0x00,0x0E,0x0E,0x1C,0x00,0x00,0x0E,0x06,0x1C,0x00,0x00,0x0E,0x06,0x0C,0x00,0x00,0x0E,0x06,0x0E,0x00,0x00,0x1E,0x06,0x07,0x00,0x00,0xFC,0xFF,0x03,0x00,0x00,0xFC,0xFF,0x01,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x7C,0xC6,0x0F,0x00,0x00,0x1C,0x06,0x0F,0x00,0x00,0x0E,0x06,0x1E,0x00,0x00,0x0E,0x06,0x1E,0x00,0x00,0x0E,0x06,0x1C,0x00,0x00,0x0E,0x06,0x1C,0x00,0x00,0x1E,0x06,0x1C,0x00,0x00,0x3C,0x06,0x1C,0x00,0x00,0xFC,0x07,0x1C,0x00,0x00,0xF8,0x07,0x1C,0x00,0x00,0xF0,0x07,0x0E,0x00,0x00,0x80,0x07,0x0E, // 230
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xFC,0xC0,0x0F,0x00,0x00,0x3C,0x00,0x0F,0x00,0x00,0x1E,0x00,0x1E,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x0E,0x00,0x3C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x1C,0x00,0x0C,0x00,0x00,0x1C,0x00,0x0E,  // 231
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x01,0xF8,0xFF,0x07,0x00,0x03,0x7C,0xCE,0x0F,0x00,0x07,0x1C,0x0E,0x0F,0x00,0x0F,0x0E,0x0E,0x0E,0x00,0x1E,0x0E,0x0E,0x1E,0x00,0x3C,0x0E,0x0E,0x1C,0x00,0x30,0x0E,0x0E,0x1C,0x00,0x20,0x1E,0x0E,0x1C,0x00,0x00,0x3C,0x0E,0x1C,0x00,0x00,0xFC,0x0F,0x1C,0x00,0x00,0xF8,0x0F,0x1C,0x00,0x00,0xF0,0x0F,0x0E,0x00,0x00,0x80,0x0F,0x0E,  // 232
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x7C,0xCE,0x0F,0x00,0x00,0x1C,0x0E,0x0F,0x00,0x20,0x0E,0x0E,0x0E,0x00,0x30,0x0E,0x0E,0x1E,0x00,0x3C,0x0E,0x0E,0x1C,0x00,0x1E,0x0E,0x0E,0x1C,0x00,0x0F,0x1E,0x0E,0x1C,0x00,0x07,0x3C,0x0E,0x1C,0x00,0x03,0xFC,0x0F,0x1C,0x00,0x01,0xF8,0x0F,0x1C,0x00,0x00,0xF0,0x0F,0x0E,0x00,0x00,0x80,0x0F,0x0E,  // 233
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x20,0xF8,0xFF,0x07,0x00,0x38,0x7C,0xCE,0x0F,0x00,0x3C,0x1C,0x0E,0x0F,0x00,0x1F,0x0E,0x0E,0x0E,0x00,0x07,0x0E,0x0E,0x1E,0x00,0x03,0x0E,0x0E,0x1C,0x00,0x0F,0x0E,0x0E,0x1C,0x00,0x1F,0x1E,0x0E,0x1C,0x00,0x3C,0x3C,0x0E,0x1C,0x00,0x38,0xFC,0x0F,0x1C,0x00,0x20,0xF8,0x0F,0x1C,0x00,0x00,0xF0,0x0F,0x0E,0x00,0x00,0x80,0x0F,0x0E,  // 234
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x38,0x7C,0xCE,0x0F,0x00,0x38,0x1C,0x0E,0x0F,0x00,0x38,0x0E,0x0E,0x0E,0x00,0x00,0x0E,0x0E,0x1E,0x00,0x00,0x0E,0x0E,0x1C,0x00,0x00,0x0E,0x0E,0x1C,0x00,0x00,0x1E,0x0E,0x1C,0x00,0x38,0x3C,0x0E,0x1C,0x00,0x38,0xFC,0x0F,0x1C,0x00,0x38,0xF8,0x0F,0x1C,0x00,0x00,0xF0,0x0F,0x0E,0x00,0x00,0x80,0x0F,0x0E,  // 235
-  0x00,0x01,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x0F,0xFE,0xFF,0x1F,0x00,0x1E,0xFE,0xFF,0x1F,0x00,0x3C,0xFE,0xFF,0x1F,0x00,0x30,0xFE,0xFF,0x1F,0x00,0x20, // 236
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFE,0xFF,0x1F,0x00,0x30,0xFE,0xFF,0x1F,0x00,0x3C,0xFE,0xFF,0x1F,0x00,0x1E,0xFE,0xFF,0x1F,0x00,0x0F,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x03, // 237
-  0x00,0x20,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x1F,0xFE,0xFF,0x1F,0x00,0x07,0xFE,0xFF,0x1F,0x00,0x03,0xFE,0xFF,0x1F,0x00,0x0F,0xFE,0xFF,0x1F,0x00,0x1F,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x38, // 238
-  0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38, // 239
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x80,0x3F,0x00,0x00,0x0E,0xE0,0xFF,0x01,0x00,0x4E,0xF0,0xFF,0x03,0x00,0xEE,0xF8,0xFF,0x07,0x00,0x7E,0xFC,0xC0,0x0F,0x00,0x3C,0x3C,0x00,0x0F,0x00,0x1C,0x1E,0x00,0x1E,0x00,0x3C,0x0E,0x00,0x1C,0x00,0x3E,0x0E,0x00,0x1C,0x00,0x7F,0x0E,0x00,0x1C,0x80,0xF3,0x0F,0x00,0x1C,0x00,0xE1,0x1F,0x00,0x1E,0x00,0xC0,0x1F,0x00,0x0F,0x00,0x80,0x7F,0xC0,0x0F,0x00,0x00,0xFF,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x01,0x00,0x00,0xC0,0x3F, // 240
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x30,0xFE,0xFF,0x1F,0x00,0x38,0x70,0x00,0x00,0x00,0x0C,0x38,0x00,0x00,0x00,0x0C,0x1C,0x00,0x00,0x00,0x0C,0x1C,0x00,0x00,0x00,0x18,0x0E,0x00,0x00,0x00,0x18,0x0E,0x00,0x00,0x00,0x30,0x0E,0x00,0x00,0x00,0x30,0x1E,0x00,0x00,0x00,0x30,0xFE,0xFF,0x1F,0x00,0x1C,0xFC,0xFF,0x1F,0x00,0x0C,0xF8,0xFF,0x1F,0x00,0x00,0xF0,0xFF,0x1F, // 241
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x01,0x7C,0x80,0x0F,0x00,0x03,0x1C,0x00,0x0E,0x00,0x07,0x1E,0x00,0x1E,0x00,0x0F,0x0E,0x00,0x1C,0x00,0x1E,0x0E,0x00,0x1C,0x00,0x3C,0x0E,0x00,0x1C,0x00,0x30,0x0E,0x00,0x1C,0x00,0x20,0x1E,0x00,0x1E,0x00,0x00,0x1C,0x00,0x0F,0x00,0x00,0x7C,0x80,0x0F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F, // 242
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0x7C,0x80,0x0F,0x00,0x00,0x1C,0x00,0x0E,0x00,0x00,0x1E,0x00,0x1E,0x00,0x20,0x0E,0x00,0x1C,0x00,0x30,0x0E,0x00,0x1C,0x00,0x3C,0x0E,0x00,0x1C,0x00,0x1E,0x0E,0x00,0x1C,0x00,0x0F,0x1E,0x00,0x1E,0x00,0x07,0x1C,0x00,0x0F,0x00,0x03,0x7C,0x80,0x0F,0x00,0x01,0xF8,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F, // 243
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x20,0x7C,0x80,0x0F,0x00,0x38,0x1C,0x00,0x0E,0x00,0x3C,0x1E,0x00,0x1E,0x00,0x1F,0x0E,0x00,0x1C,0x00,0x07,0x0E,0x00,0x1C,0x00,0x03,0x0E,0x00,0x1C,0x00,0x0F,0x0E,0x00,0x1C,0x00,0x1F,0x1E,0x00,0x1E,0x00,0x3C,0x1C,0x00,0x0F,0x00,0x38,0x7C,0x80,0x0F,0x00,0x20,0xF8,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F, // 244
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x30,0xF8,0xFF,0x07,0x00,0x38,0x7C,0x80,0x0F,0x00,0x0C,0x1C,0x00,0x0E,0x00,0x0C,0x1E,0x00,0x1E,0x00,0x0C,0x0E,0x00,0x1C,0x00,0x18,0x0E,0x00,0x1C,0x00,0x18,0x0E,0x00,0x1C,0x00,0x30,0x0E,0x00,0x1C,0x00,0x30,0x1E,0x00,0x1E,0x00,0x30,0x1C,0x00,0x0F,0x00,0x1C,0x7C,0x80,0x0F,0x00,0x0C,0xF8,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F, // 245
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xF8,0xFF,0x07,0x00,0x38,0x7C,0x80,0x0F,0x00,0x38,0x1C,0x00,0x0E,0x00,0x38,0x1E,0x00,0x1E,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x38,0x1E,0x00,0x1E,0x00,0x38,0x1C,0x00,0x0F,0x00,0x38,0x7C,0x80,0x0F,0x00,0x00,0xF8,0xFF,0x07,0x00,0x00,0xF0,0xFF,0x03,0x00,0x00,0xE0,0xFF,0x01,0x00,0x00,0x80,0x7F, // 246
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0F,0x0E,0x1E,0x00,0x00,0x0F,0x0E,0x1E,0x00,0x00,0x0F,0x0E,0x1E,0x00,0x00,0x0F,0x0E,0x1E,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E, // 247
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x10,0x00,0x00,0xE0,0xFF,0x19,0x00,0x00,0xF0,0xFF,0x1F,0x00,0x00,0xF8,0xFF,0x0F,0x00,0x00,0x7C,0x80,0x0F,0x00,0x00,0x1C,0xC0,0x0F,0x00,0x00,0x1E,0xF0,0x1E,0x00,0x00,0x0E,0x78,0x1C,0x00,0x00,0x0E,0x3C,0x1C,0x00,0x00,0x0E,0x0F,0x1C,0x00,0x00,0x8E,0x07,0x1C,0x00,0x00,0xDE,0x03,0x1E,0x00,0x00,0xFC,0x00,0x0E,0x00,0x00,0x7C,0x80,0x0F,0x00,0x00,0xFC,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xE6,0xFF,0x01,0x00,0x00,0x82,0x7F, // 248
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x01,0xFE,0xFF,0x1F,0x00,0x03,0x00,0x00,0x1E,0x00,0x07,0x00,0x00,0x1C,0x00,0x0F,0x00,0x00,0x1C,0x00,0x1E,0x00,0x00,0x1C,0x00,0x3C,0x00,0x00,0x0E,0x00,0x30,0x00,0x00,0x0E,0x00,0x20,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F, // 249
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x1C,0x00,0x20,0x00,0x00,0x1C,0x00,0x30,0x00,0x00,0x1C,0x00,0x3C,0x00,0x00,0x0E,0x00,0x1E,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x07,0x00,0x07,0x00,0x80,0x03,0x00,0x03,0xFE,0xFF,0x1F,0x00,0x01,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F, // 250
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x20,0xFE,0xFF,0x1F,0x00,0x38,0x00,0x00,0x1E,0x00,0x3C,0x00,0x00,0x1C,0x00,0x1F,0x00,0x00,0x1C,0x00,0x07,0x00,0x00,0x1C,0x00,0x03,0x00,0x00,0x0E,0x00,0x0F,0x00,0x00,0x0E,0x00,0x1F,0x00,0x00,0x07,0x00,0x3C,0x00,0x80,0x03,0x00,0x38,0xFE,0xFF,0x1F,0x00,0x20,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F, // 251
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x03,0x00,0x00,0xFE,0xFF,0x07,0x00,0x00,0xFE,0xFF,0x0F,0x00,0x38,0xFE,0xFF,0x1F,0x00,0x38,0x00,0x00,0x1E,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x0E,0x00,0x38,0x00,0x00,0x07,0x00,0x38,0x00,0x80,0x03,0x00,0x38,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F,0x00,0x00,0xFE,0xFF,0x1F, // 252
-  0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x00,0xE0,0xFF,0x00,0x00,0x00,0x00,0xFF,0x03,0x00,0x20,0x00,0xFC,0x1F,0x00,0x30,0x00,0xE0,0x3F,0x00,0x3C,0x00,0x80,0x3F,0x00,0x1E,0x00,0x80,0x3F,0x00,0x0F,0x00,0xF0,0x0F,0x00,0x07,0x00,0xFC,0x01,0x00,0x03,0x80,0x7F,0x00,0x00,0x01,0xE0,0x1F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x06, // 253
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0xFE,0xFF,0xFF,0x3F,0x00,0x00,0x60,0x00,0x07,0x00,0x00,0x38,0x00,0x0E,0x00,0x00,0x1C,0x00,0x0E,0x00,0x00,0x1C,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1C,0x00,0x00,0x0E,0x00,0x1E,0x00,0x00,0x1E,0x00,0x0F,0x00,0x00,0x7C,0xC0,0x0F,0x00,0x00,0xFC,0xFF,0x07,0x00,0x00,0xF8,0xFF,0x03,0x00,0x00,0xF0,0xFF,0x01,0x00,0x00,0xC0,0x3F,  // 254
-  0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0xFE,0x07,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x38,0xE0,0xFF,0x00,0x00,0x38,0x00,0xFF,0x03,0x00,0x38,0x00,0xFC,0x1F,0x00,0x00,0x00,0xE0,0x3F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0x80,0x3F,0x00,0x00,0x00,0xF0,0x0F,0x00,0x38,0x00,0xFC,0x01,0x00,0x38,0x80,0x7F,0x00,0x00,0x38,0xE0,0x1F,0x00,0x00,0x00,0xF8,0x03,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x06  // 255
-};
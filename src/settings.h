@@ -34,12 +34,29 @@ const int UPDATE_INTERVAL_SECS = 10 * 60; // Update every 10 minutes
 const int SCREEN_CHANGE_SECS = 0;
 const int SLEEP_INTERVAL_SECS = 0;        // Going to sleep after idle times, set 0 for insomnia
 
+// BATTERY_MODE only: a wake that cannot join WiFi within this time goes back to sleep
+#define BATTERY_CONNECT_TIMEOUT 10000
+
+// Stack of the ESP32 network task, see NETWORK_TASK in platformio.ini
+#define NETWORK_TASK_STACK 8192
+
 // OpenWeatherMap Settings
 // Sign up here to get an API key: https://docs.thingpulse.com/how-tos/openweathermap-key/
 String OPEN_WEATHER_MAP_API_KEY = CONFIG_OPEN_WEATHER_MAP_API_KEY;
 String OPEN_WEATHER_MAP_LOCATION_ID = CONFIG_OPEN_WEATHER_MAP_LOCATION_ID;
 String DISPLAYED_LOCATION_NAME = CONFIG_DISPLAYED_LOCATION_NAME;
 
+// Server the weather is downloaded from. Point it to tools/weather_stub_server.py
+// to replay recorded responses instead.
+#ifndef CONFIG_OPEN_WEATHER_MAP_HOST
+#define CONFIG_OPEN_WEATHER_MAP_HOST "api.openweathermap.org"
+#endif
+#ifndef CONFIG_OPEN_WEATHER_MAP_PORT
+#define CONFIG_OPEN_WEATHER_MAP_PORT 80
+#endif
+String OPEN_WEATHER_MAP_HOST = CONFIG_OPEN_WEATHER_MAP_HOST;
+const uint16_t OPEN_WEATHER_MAP_PORT = CONFIG_OPEN_WEATHER_MAP_PORT;
+
 /*
 Arabic -> ar, Bulgarian -> bg, Catalan -> ca, Czech -> cz, German -> de, Greek -> el,
 English -> en, Persian (Farsi) -> fa, Finnish -> fi, French -> fr, Galician -> gl,
@@ -53,11 +70,11 @@ Chinese Simplified -> zh_cn, Chinese Traditional -> zh_tw.
 const String OPEN_WEATHER_MAP_LANGUAGE = CONFIG_OPEN_WEATHER_MAP_LANGUAGE;
 
 // Adjust according to your language
-const String WDAY_NAMES[] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
-const String MONTH_NAMES[] = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
-const String SUN_MOON_TEXT[] = {"Sun", "Rise", "Set", "Moon", "Age", "Illum"};
-const String MOON_PHASES[] = {"New Moon", "Waxing Crescent", "First Quarter", "Waxing Gibbous",
-                              "Full Moon", "Waning Gibbous", "Third quarter", "Waning Crescent"};
+const char *const WDAY_NAMES[] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
+const char *const MONTH_NAMES[] = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
+const char *const SUN_MOON_TEXT[] = {"Sun", "Rise", "Set", "Moon", "Age", "Illum"};
+const char *const MOON_PHASES[] = {"New Moon", "Waxing Crescent", "First Quarter", "Waxing Gibbous",
+                                   "Full Moon", "Waning Gibbous", "Third quarter", "Waning Crescent"};
 
 // pick one from TZinfo.h
 String TIMEZONE = getTzInfo(TZ_TIMEZONE);
@@ -80,4 +97,7 @@ bool IS_STYLE_HHMM = false; // true => HH:MM
 #define NTP_SERVERS "us.pool.ntp.org", "time.nist.gov", "pool.ntp.org"
 
 // August 1st, 2018
-#define NTP_MIN_VALID_EPOCH 1533081600
\ No newline at end of file
+#define NTP_MIN_VALID_EPOCH 1533081600
+
+// Longest wait for a time server, the clock is set later if one answers after
+#define NTP_SYNC_TIMEOUT 10000
\ No newline at end of file
@@ -0,0 +1,490 @@
+#!/usr/bin/env python3
+"""Generates PROGMEM headers in include/generated/ from resources/assets.ini.
+
+  tools/build_assets.py
+
+PlatformIO runs it before every build (extra_scripts in platformio.ini).
+Headers are only rewritten when their content changes, so unchanged assets
+do not trigger a rebuild.
+
+Each section of the manifest becomes include/generated/<section>.h:
+
+  [moonphases]
+  files = moonphases/moonphase_L*.bmp
+  depth = 2
+  resize = 40x40
+  palette = 000000 FFFFFF
+  dither = ordered
+  compress = rle
+
+Images (uncompressed BMP, non-interlaced PNG) are converted to MiniGrafx's
+paletted bitmap format at 1, 2 or 4 bits per pixel, optionally scaled to
+the resize dimensions by area averaging. With a palette, every
+pixel is mapped to the nearest listed color and its index, so the palette
+should list the display palette entries in order. Without one, the most
+frequent colors are picked and emitted as an RGB565 `<section>_Palette`.
+dither = ordered mixes neighbouring palette colors for shades in between.
+compress = rle writes the run length encoded format of compress_icons.py
+(depth 1 and 2 only).
+
+Every image becomes a `const char <name>[] PROGMEM` named after its file,
+identical images are stored once. A `<section>[]` table lists them in
+natural file order, with `<section>_Count` and, when all images share them,
+`<section>_Width` and `<section>_Height`.
+
+A section with `font = <file>.ttf` and `size = <pixels>` instead becomes a
+MiniGrafx font named `<section>`. Rendering TrueType needs Pillow
+(pip install pillow); images do not.
+"""
+import configparser
+import glob
+import os
+import re
+import struct
+import sys
+import zlib
+
+RAW_VERSION = 0x01
+RLE_VERSION = 0x81
+MAX_RUN = 64 + 255
+
+BAYER_4X4 = [0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5]
+
+
+class Image:
+    def __init__(self, width, height, pixels):
+        self.width = width
+        self.height = height
+        # rows of (r, g, b, a) tuples, top to bottom
+        self.pixels = pixels
+
+
+def read_bmp(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] != b"BM":
+        raise ValueError("not a BMP file")
+    offset = struct.unpack_from("<I", data, 10)[0]
+    width, height, _, bits, compression = struct.unpack_from("<iiHHI", data, 18)
+    if compression not in (0, 3) or bits not in (8, 24, 32):
+        raise ValueError("only uncompressed 8, 24 and 32 bit BMPs are supported")
+    colors = []
+    if bits == 8:
+        header_size = struct.unpack_from("<I", data, 14)[0]
+        count = struct.unpack_from("<I", data, 46)[0] or 256
+        for i in range(count):
+            b, g, r = data[14 + header_size + i * 4:17 + header_size + i * 4]
+            colors.append((r, g, b, 255))
+    stride = (width * bits // 8 + 3) & ~3
+    rows = []
+    for y in range(abs(height)):
+        start = offset + y * stride
+        row = []
+        for x in range(width):
+            if bits == 8:
+                row.append(colors[data[start + x]])
+            else:
+                i = start + x * bits // 8
+                row.append((data[i + 2], data[i + 1], data[i], data[i + 3] if bits == 32 else 255))
+        rows.append(row)
+    # positive heights are stored bottom up
+    if height > 0:
+        rows.reverse()
+    return Image(width, abs(height), rows)
+
+
+def unfilter_png(raw, width, height, bits_per_pixel):
+    stride = (width * bits_per_pixel + 7) // 8
+    step = max(1, bits_per_pixel // 8)
+    rows = []
+    previous = bytearray(stride)
+    i = 0
+    for _ in range(height):
+        kind = raw[i]
+        row = bytearray(raw[i + 1:i + 1 + stride])
+        i += 1 + stride
+        for x in range(stride):
+            left = row[x - step] if x >= step else 0
+            up = previous[x]
+            corner = previous[x - step] if x >= step else 0
+            if kind == 1:
+                row[x] = (row[x] + left) & 0xFF
+            elif kind == 2:
+                row[x] = (row[x] + up) & 0xFF
+            elif kind == 3:
+                row[x] = (row[x] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                estimate = left + up - corner
+                pa, pb, pc = abs(estimate - left), abs(estimate - up), abs(estimate - corner)
+                predictor = left if pa <= pb and pa <= pc else up if pb <= pc else corner
+                row[x] = (row[x] + predictor) & 0xFF
+        rows.append(row)
+        previous = row
+    return rows
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG file")
+    i = 8
+    idat = b""
+    colors = []
+    alphas = b""
+    while i < len(data):
+        length, kind = struct.unpack_from(">I4s", data, i)
+        body = data[i + 8:i + 8 + length]
+        i += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            colors = [tuple(body[j:j + 3]) for j in range(0, length, 3)]
+        elif kind == b"tRNS":
+            alphas = body
+        elif kind == b"IDAT":
+            idat += body
+    if interlace:
+        raise ValueError("interlaced PNGs are not supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    if depth != 8 and not (color_type in (0, 3) and depth in (1, 2, 4)):
+        raise ValueError("only 8 bit channels are supported")
+    rows = unfilter_png(zlib.decompress(idat), width, height, channels * depth)
+    pixels = []
+    for row in rows:
+        out = []
+        for x in range(width):
+            if depth < 8:
+                value = row[x * depth // 8] >> (8 - depth - x * depth % 8) & ((1 << depth) - 1)
+                if color_type == 0:
+                    value = value * 255 // ((1 << depth) - 1)
+                sample = (value,)
+            else:
+                sample = tuple(row[x * channels:(x + 1) * channels])
+            if color_type == 3:
+                alpha = alphas[sample[0]] if sample[0] < len(alphas) else 255
+                out.append(colors[sample[0]] + (alpha,))
+            elif color_type == 0:
+                out.append((sample[0],) * 3 + (255,))
+            elif color_type == 4:
+                out.append((sample[0],) * 3 + (sample[1],))
+            elif color_type == 2:
+                out.append(sample + (255,))
+            else:
+                out.append(sample)
+        pixels.append(out)
+    return Image(width, height, pixels)
+
+
+def read_image(path):
+    if path.lower().endswith(".bmp"):
+        return read_bmp(path)
+    if path.lower().endswith(".png"):
+        return read_png(path)
+    raise ValueError("unknown image type")
+
+
+def axis_weights(source, target):
+    # (source index, weight) pairs covering each target pixel, weights sum to 1
+    scale = source / target
+    weights = []
+    for t in range(target):
+        start, end = t * scale, (t + 1) * scale
+        pairs = []
+        s = int(start)
+        while s < end and s < source:
+            overlap = min(end, s + 1) - max(start, s)
+            if overlap > 0:
+                pairs.append((s, overlap / scale))
+            s += 1
+        weights.append(pairs)
+    return weights
+
+
+def resize(image, width, height):
+    # area average, colors weighted by their alpha
+    columns = axis_weights(image.width, width)
+    rows = axis_weights(image.height, height)
+    pixels = []
+    for row_weights in rows:
+        out = []
+        for column_weights in columns:
+            total = [0.0] * 4
+            for sy, wy in row_weights:
+                for sx, wx in column_weights:
+                    r, g, b, a = image.pixels[sy][sx]
+                    weight = wx * wy
+                    total[0] += r * a * weight
+                    total[1] += g * a * weight
+                    total[2] += b * a * weight
+                    total[3] += a * weight
+            alpha = total[3]
+            if alpha:
+                out.append(tuple(int(round(c / alpha)) for c in total[:3]) + (int(round(alpha)),))
+            else:
+                out.append((0, 0, 0, 0))
+        pixels.append(out)
+    return Image(width, height, pixels)
+
+
+def parse_color(text):
+    value = int(text, 16)
+    return (value >> 16 & 0xFF, value >> 8 & 0xFF, value & 0xFF)
+
+
+def rgb565(color):
+    r, g, b = color
+    return (r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3
+
+
+def popular_colors(images, count):
+    # popularity on a 4 bit per channel grid, transparent pixels count as black
+    counts = {}
+    for image in images:
+        for row in image.pixels:
+            for r, g, b, a in row:
+                key = (r >> 4, g >> 4, b >> 4) if a >= 128 else (0, 0, 0)
+                counts[key] = counts.get(key, 0) + 1
+    best = sorted(counts, key=lambda key: -counts[key])[:count]
+    return [(r * 17, g * 17, b * 17) for r, g, b in best]
+
+
+def distance(a, b):
+    return (a[0] - b[0]) ** 2 + (a[1] - b[1]) ** 2 + (a[2] - b[2]) ** 2
+
+
+def quantize(image, palette, dither):
+    indices = []
+    for y, row in enumerate(image.pixels):
+        for x, (r, g, b, a) in enumerate(row):
+            color = (r, g, b) if a >= 128 else (0, 0, 0)
+            ranked = sorted(range(len(palette)), key=lambda i: distance(color, palette[i]))
+            index = ranked[0]
+            if dither and len(ranked) > 1:
+                near, far = palette[ranked[0]], palette[ranked[1]]
+                span = distance(near, far)
+                if span:
+                    # share of the second color along the line between both
+                    share = sum((c - n) * (f - n) for c, n, f in zip(color, near, far)) / span
+                    if share * 16 > BAYER_4X4[(y & 3) * 4 + (x & 3)] + 0.5:
+                        index = ranked[1]
+            indices.append(index)
+    return indices
+
+
+def encode_raw(width, height, depth, indices):
+    per_byte = 8 // depth
+    # rows are padded to whole bytes
+    padded = (width + per_byte - 1) // per_byte * per_byte
+    out = bytearray([RAW_VERSION, depth, width >> 8, width & 0xFF, height >> 8, height & 0xFF])
+    out += bytes(padded * height // per_byte)
+    for y in range(height):
+        for x in range(width):
+            i = y * padded + x
+            out[6 + i // per_byte] |= indices[y * width + x] << ((per_byte - 1 - i % per_byte) * depth)
+    return bytes(out)
+
+
+def encode_rle(width, height, depth, indices):
+    out = bytearray([RLE_VERSION, depth, width >> 8, width & 0xFF, height >> 8, height & 0xFF])
+    i = 0
+    while i < len(indices):
+        index = indices[i]
+        length = 1
+        while i + length < len(indices) and indices[i + length] == index and length < MAX_RUN:
+            length += 1
+        if length < 64:
+            out.append(index << 6 | length - 1)
+        else:
+            out += bytes([index << 6 | 63, length - 64])
+        i += length
+    return bytes(out)
+
+
+def c_name(path):
+    return re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+
+
+def natural_key(path):
+    return [int(part) if part.isdigit() else part for part in re.split(r"(\d+)", path)]
+
+
+def format_bytes(data, comments):
+    # comments are (byte count, text) for the leading header fields
+    lines = []
+    start = 0
+    for count, comment in comments:
+        lines.append("  " + " ".join("0x%02X," % b for b in data[start:start + count]) + " // " + comment)
+        start += count
+    for i in range(start, len(data), 20):
+        lines.append("  " + " ".join("0x%02X," % b for b in data[i:i + 20]))
+    return "\n".join(lines)
+
+
+def build_images(name, section, resources):
+    paths = sorted(glob.glob(os.path.join(resources, section["files"])), key=natural_key)
+    if not paths:
+        raise ValueError("no files match " + section["files"])
+    depth = section.getint("depth", 2)
+    if depth not in (1, 2, 4):
+        raise ValueError("depth must be 1, 2 or 4")
+    compress = section.get("compress", "none")
+    if compress == "rle" and depth > 2:
+        raise ValueError("rle needs a depth of 1 or 2")
+    dither = section.get("dither", "none") == "ordered"
+
+    dimensions = section.get("resize")
+    if dimensions is not None and not re.match(r"^\d+x\d+$", dimensions):
+        raise ValueError("resize must be <width>x<height>")
+
+    images = []
+    for path in paths:
+        try:
+            image = read_image(path)
+        except (ValueError, KeyError, struct.error) as error:
+            raise ValueError("%s: %s" % (path, error))
+        if dimensions is not None:
+            image = resize(image, *map(int, dimensions.split("x")))
+        images.append(image)
+
+    palette = [parse_color(color) for color in section.get("palette", "").split()]
+    generated_palette = not palette
+    if generated_palette:
+        palette = popular_colors(images, 1 << depth)
+    if len(palette) > 1 << depth:
+        raise ValueError("%d colors do not fit %d bits" % (len(palette), depth))
+
+    lines = []
+    unique = {}
+    symbols = []
+    raw_size = 0
+    size = 0
+    for path, image in zip(paths, images):
+        indices = quantize(image, palette, dither)
+        raw = encode_raw(image.width, image.height, depth, indices)
+        data = encode_rle(image.width, image.height, depth, indices) if compress == "rle" else raw
+        raw_size += len(raw)
+        symbol = c_name(path)
+        if symbol == name:
+            raise ValueError("%s: image named like its section" % path)
+        symbols.append(symbol)
+        if data in unique:
+            lines.append("constexpr const char *%s = %s;" % (symbol, unique[data]))
+            lines.append("")
+            continue
+        unique[data] = symbol
+        size += len(data)
+        lines.append("const char %s[] PROGMEM = {" % symbol)
+        lines.append(format_bytes(data, [
+            (1, "Version: %s" % ("RLE" if data[0] == RLE_VERSION else data[0])),
+            (1, "BitDepth: %d" % depth),
+            (2, "Width: %d" % image.width),
+            (2, "Height: %d" % image.height),
+        ]))
+        lines.append("};")
+        lines.append("")
+
+    header = ["#pragma once", ""]
+    if generated_palette:
+        header.append("const uint16_t %s_Palette[] = {%s};" % (name, ", ".join("0x%04X" % rgb565(c) for c in palette)))
+    header.append("const uint8_t %s_Count = %d;" % (name, len(images)))
+    if len(set((image.width, image.height) for image in images)) == 1:
+        header.append("const uint16_t %s_Width = %d;" % (name, images[0].width))
+        header.append("const uint16_t %s_Height = %d;" % (name, images[0].height))
+    header.append("")
+
+    table = ["const char *const %s[] PROGMEM = {" % name]
+    table += ["  %s," % symbol for symbol in symbols]
+    table.append("};")
+
+    report = "%s: %d images (%d duplicates), %d bytes, %d uncompressed" % (
+        name, len(images), len(images) - len(unique), size, raw_size)
+    return "\n".join(header + lines + table) + "\n", report
+
+
+def build_font(name, section, resources):
+    try:
+        from PIL import ImageFont
+    except ImportError:
+        raise ValueError("fonts need Pillow, pip install pillow")
+    font = ImageFont.truetype(os.path.join(resources, section["font"]), section.getint("size"))
+    first = section.getint("first", 32)
+    count = section.getint("count", 224)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+    rows = (height + 7) // 8
+
+    jumps = []
+    glyphs = bytearray()
+    max_width = 0
+    for code in range(first, first + count):
+        char = bytes([code]).decode("latin-1")
+        mask = font.getmask(char, mode="1")
+        left = font.getbbox(char)[0] if mask.size[0] else 0
+        top = font.getbbox(char)[1] if mask.size[0] else 0
+        advance = int(round(font.getlength(char)))
+        max_width = max(max_width, advance)
+        # columns of `rows` bytes, least significant bit at the top
+        columns = bytearray()
+        for x in range(advance):
+            column = bytearray(rows)
+            for y in range(height):
+                mx, my = x - left, y - top
+                if 0 <= mx < mask.size[0] and 0 <= my < mask.size[1] and mask.getpixel((mx, my)):
+                    column[y // 8] |= 1 << (y % 8)
+            columns += column
+        columns = columns.rstrip(b"\0")
+        if not columns:
+            jumps += [0xFF, 0xFF, 0x00, advance]
+            continue
+        jumps += [len(glyphs) >> 8, len(glyphs) & 0xFF, len(columns), advance]
+        glyphs += columns
+
+    data = bytes([max_width, height, first, count]) + bytes(jumps) + bytes(glyphs)
+    text = "#pragma once\n\nconst char %s[] PROGMEM = {\n%s\n};\n" % (name, format_bytes(data, [
+        (1, "Width: %d" % max_width), (1, "Height: %d" % height),
+        (1, "First Char: %d" % first), (1, "Numbers of Chars: %d" % count),
+    ]))
+    return text, "%s: font, %d bytes" % (name, len(data))
+
+
+def build(project_dir):
+    resources = os.path.join(project_dir, "resources")
+    output = os.path.join(project_dir, "include", "generated")
+    manifest = configparser.ConfigParser(inline_comment_prefixes=(";", "#"))
+    manifest.read(os.path.join(resources, "assets.ini"))
+    os.makedirs(output, exist_ok=True)
+
+    for name in manifest.sections():
+        section = manifest[name]
+        try:
+            if "font" in section:
+                text, report = build_font(name, section, resources)
+            else:
+                text, report = build_images(name, section, resources)
+        except (ValueError, KeyError, OSError) as error:
+            sys.exit("assets: %s: %s" % (name, error))
+        text = "// Generated by tools/build_assets.py from resources/assets.ini, do not edit\n" + text
+
+        path = os.path.join(output, name + ".h")
+        if os.path.exists(path):
+            with open(path) as f:
+                if f.read() == text:
+                    print("assets: " + report + ", unchanged")
+                    continue
+        with open(path, "w") as f:
+            f.write(text)
+        print("assets: " + report)
+
+
+try:
+    Import("env")  # noqa: F821, defined when run by PlatformIO
+except NameError:
+    env = None
+
+if env is not None:
+    build(env.subst("$PROJECT_DIR"))
+elif __name__ == "__main__":
+    if len(sys.argv) != 1:
+        sys.exit(__doc__)
+    build(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Run length encodes the 2 bit paletted bitmaps in a header, in place.
+
+  tools/compress_icons.py src/weathericons.h
+  tools/compress_icons.py --raw src/weathericons.h
+
+Every `const char name[] PROGMEM = {...};` array in MiniGrafx's paletted
+format (version 1) is replaced by the run length encoded format that
+Canvas::drawPalettedBitmapFromPgm() decodes. Arrays that are already
+compressed are left alone, so the script can be run again after new raw
+icons were pasted in. --raw converts everything back to version 1.
+
+Both formats share the 6 byte header: version, bit depth, big endian width
+and height. Raw rows are padded to whole bytes, a multiple of 4 pixels. Encoded pixels
+are not padded and runs continue across row ends. A run byte holds the
+palette index in its top 2 bits and the length minus one in the lower 6;
+a length field of 63 means 64 plus the following byte.
+"""
+import re
+import sys
+
+RAW_VERSION = 0x01
+RLE_VERSION = 0x81
+MAX_RUN = 64 + 255
+
+ARRAY = re.compile(r"(const char (\w+)\[\] PROGMEM = \{)(.*?)(\};)", re.S)
+
+
+def parse_bytes(body):
+    body = re.sub(r"//[^\n]*", "", body)
+    return bytes(int(value, 16) for value in re.findall(r"0x([0-9A-Fa-f]{2})", body))
+
+
+def header(data):
+    return data[0], data[1], data[2] << 8 | data[3], data[4] << 8 | data[5]
+
+
+def row_pixels(width):
+    # raw rows end on a byte boundary, 4 pixels of 2 bits each
+    return (width + 3) & ~3
+
+
+def raw_pixels(data):
+    _, _, width, height = header(data)
+    padded = row_pixels(width)
+    pixels = []
+    for y in range(height):
+        for x in range(width):
+            i = y * padded + x
+            pixels.append(data[6 + i // 4] >> ((3 - i % 4) * 2) & 3)
+    return pixels
+
+
+def rle_pixels(data):
+    _, _, width, height = header(data)
+    pixels = []
+    i = 6
+    while len(pixels) < width * height:
+        run = data[i]
+        i += 1
+        length = (run & 0x3F) + 1
+        if length == 64:
+            length += data[i]
+            i += 1
+        pixels += [run >> 6] * length
+    return pixels
+
+
+def encode_rle(width, height, pixels):
+    out = bytearray([RLE_VERSION, 2, width >> 8, width & 0xFF, height >> 8, height & 0xFF])
+    i = 0
+    while i < len(pixels):
+        color = pixels[i]
+        length = 1
+        while i + length < len(pixels) and pixels[i + length] == color and length < MAX_RUN:
+            length += 1
+        if length < 64:
+            out.append(color << 6 | length - 1)
+        else:
+            out += bytes([color << 6 | 63, length - 64])
+        i += length
+    return bytes(out)
+
+
+def encode_raw(width, height, pixels):
+    padded = row_pixels(width)
+    out = bytearray([RAW_VERSION, 2, width >> 8, width & 0xFF, height >> 8, height & 0xFF])
+    out += bytes(padded * height // 4)
+    for y in range(height):
+        for x in range(width):
+            i = y * padded + x
+            out[6 + i // 4] |= pixels[y * width + x] << ((3 - i % 4) * 2)
+    return bytes(out)
+
+
+def format_array(data):
+    version, depth, width, height = header(data)
+    lines = [
+        "  0x%02X, // Version: %s" % (version, "RLE" if version == RLE_VERSION else version),
+        "  0x%02X, // BitDepth: %d" % (depth, depth),
+        "  0x%02X, 0x%02X, // Width: %d" % (data[2], data[3], width),
+        "  0x%02X, 0x%02X, // Height: %d" % (data[4], data[5], height),
+    ]
+    if version == RLE_VERSION:
+        lines.append("  // Runs: index << 6 | length - 1, 63 adds the next byte to 64")
+    else:
+        lines.append("  // Round width to next byte: %d" % row_pixels(width))
+    body = data[6:]
+    for start in range(0, len(body), 20):
+        lines.append("  " + " ".join("0x%02X," % b for b in body[start:start + 20]))
+    return "\n" + "\n".join(lines) + "\n"
+
+
+def main():
+    args = sys.argv[1:]
+    to_raw = "--raw" in args
+    args = [arg for arg in args if arg != "--raw"]
+    if len(args) != 1:
+        sys.exit(__doc__)
+    path = args[0]
+    with open(path) as f:
+        source = f.read()
+
+    before = after = 0
+
+    def convert(match):
+        nonlocal before, after
+        data = parse_bytes(match.group(3))
+        version, depth, width, height = header(data)
+        if depth != 2 or version not in (RAW_VERSION, RLE_VERSION):
+            sys.exit("%s: unsupported bitmap version %d, depth %d" % (match.group(2), version, depth))
+        pixels = raw_pixels(data) if version == RAW_VERSION else rle_pixels(data)
+        converted = encode_raw(width, height, pixels) if to_raw else encode_rle(width, height, pixels)
+        before += len(data)
+        after += len(converted)
+        indent = match.group(3)[len(match.group(3).rstrip(" ")):]
+        return match.group(1) + format_array(converted) + indent + match.group(4)
+
+    source = ARRAY.sub(convert, source)
+    with open(path, "w") as f:
+        f.write(source)
+    print("%s: %d -> %d bytes" % (path, before, after), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
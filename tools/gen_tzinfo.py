@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Generates src/TZinfo.h from the posix_tz_db zones.csv.
+
+  curl -O https://raw.githubusercontent.com/nayarsystems/posix_tz_db/master/zones.csv
+  tools/gen_tzinfo.py zones.csv > src/TZinfo.h
+
+Zone names are sorted in strcmp() order so getTzInfo() can binary search
+them. Names and POSIX strings are packed into two NUL separated PROGMEM
+blobs, and identical POSIX strings are stored once.
+"""
+import csv
+import sys
+import time
+
+
+def c_string(value):
+    return '"' + value.replace("\\", "\\\\").replace('"', '\\"') + '\\0"'
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+    with open(sys.argv[1], newline="") as f:
+        zones = {row[0]: row[1] for row in csv.reader(f) if len(row) >= 2}
+    names = sorted(zones, key=lambda name: name.encode())
+
+    posix_offsets = {}
+    posix_blob = []
+    posix_size = 0
+    for posix in sorted(set(zones.values())):
+        posix_offsets[posix] = posix_size
+        posix_blob.append(posix)
+        posix_size += len(posix.encode()) + 1
+
+    name_offsets = []
+    name_size = 0
+    for name in names:
+        name_offsets.append(name_size)
+        name_size += len(name.encode()) + 1
+    if max(name_size, posix_size) > 0xFFFF:
+        sys.exit("table does not fit 16 bit offsets")
+
+    out = sys.stdout
+    out.write("#pragma once\n\n")
+    out.write("// auto-generated by tools/gen_tzinfo.py on %s\n" % time.strftime("%a %b %d %H:%M:%S UTC %Y", time.gmtime()))
+    out.write("//\n// This database is auto-generated from\n")
+    out.write("//    https://raw.githubusercontent.com/nayarsystems/posix_tz_db/master/zones.csv\n")
+    out.write("//    which is based on the IANA timezone database at\n//    https://www.iana.org/time-zones\n\n")
+    out.write("#include <Arduino.h>\n\n")
+    out.write("// %d zone names sorted in strcmp() order, NUL separated\n" % len(names))
+    out.write("static const char TZ_NAMES[] PROGMEM =\n")
+    out.write("\n".join("    " + c_string(name) for name in names) + ";\n\n")
+    out.write("// %d distinct POSIX TZ strings, NUL separated\n" % len(posix_blob))
+    out.write("static const char TZ_POSIX[] PROGMEM =\n")
+    out.write("\n".join("    " + c_string(posix) for posix in posix_blob) + ";\n\n")
+    out.write("struct TzZone\n{\n  uint16_t name;\n  uint16_t posix;\n};\n\n")
+    out.write("// offsets into TZ_NAMES and TZ_POSIX, same order as TZ_NAMES\n")
+    out.write("static const TzZone TZ_ZONES[] PROGMEM = {\n")
+    for name, offset in zip(names, name_offsets):
+        out.write("    {%d, %d}, // %s\n" % (offset, posix_offsets[zones[name]], name))
+    out.write("};\n\n")
+    out.write(LOOKUP)
+
+
+LOOKUP = """// Returns the POSIX TZ string of a zone as a PROGMEM pointer, nullptr if unknown
+PGM_P findTzInfo(const char *timezone)
+{
+  int16_t low = 0;
+  int16_t high = sizeof(TZ_ZONES) / sizeof(TzZone) - 1;
+  while (low <= high)
+  {
+    int16_t middle = (low + high) / 2;
+    int order = strcmp_P(timezone, TZ_NAMES + pgm_read_word(&TZ_ZONES[middle].name));
+    if (order == 0)
+    {
+      return TZ_POSIX + pgm_read_word(&TZ_ZONES[middle].posix);
+    }
+    if (order < 0)
+    {
+      high = middle - 1;
+    }
+    else
+    {
+      low = middle + 1;
+    }
+  }
+  return nullptr;
+}
+
+String getTzInfo(const String &timezone) {
+  PGM_P posix = findTzInfo(timezone.c_str());
+  return posix != nullptr ? String(FPSTR(posix)) : String(F("UTC0"));
+}
+"""
+
+if __name__ == "__main__":
+    main()
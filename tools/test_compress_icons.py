@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Round trips of compress_icons.py between the raw and the encoded format.
+
+  python3 -m unittest discover -s tools -p "test_*.py"
+"""
+import os
+import unittest
+
+import compress_icons
+
+ICONS = os.path.join(os.path.dirname(__file__), "..", "src", "weathericons.h")
+
+# 3 x 3 pixels, each row padded to 4 pixels (1 byte) as MiniGrafx reads it.
+# Rounding rows to 8 pixels instead would read the second row from byte 2.
+ODD_PIXELS = [
+    0, 1, 2,
+    3, 3, 3,
+    1, 0, 2,
+]
+ODD_RAW = bytes([0x01, 0x02, 0x00, 0x03, 0x00, 0x03,
+                 0b00011000,
+                 0b11111100,
+                 0b01001000])
+
+
+def icons():
+    with open(ICONS) as f:
+        source = f.read()
+    return {match.group(2): compress_icons.parse_bytes(match.group(3))
+            for match in compress_icons.ARRAY.finditer(source)}
+
+
+class CompressIconsTest(unittest.TestCase):
+    def test_odd_width_raw_decodes_to_its_pixels(self):
+        self.assertEqual(compress_icons.raw_pixels(ODD_RAW), ODD_PIXELS)
+
+    def test_odd_width_raw_encodes_to_the_same_bytes(self):
+        self.assertEqual(compress_icons.encode_raw(3, 3, ODD_PIXELS), ODD_RAW)
+
+    def test_odd_width_round_trip_through_rle(self):
+        encoded = compress_icons.encode_rle(3, 3, compress_icons.raw_pixels(ODD_RAW))
+        self.assertEqual(compress_icons.rle_pixels(encoded), ODD_PIXELS)
+
+    def test_icons_round_trip_through_raw(self):
+        for name, data in icons().items():
+            _, _, width, height = compress_icons.header(data)
+            pixels = compress_icons.rle_pixels(data)
+            raw = compress_icons.encode_raw(width, height, pixels)
+            # one byte holds 4 pixels, rows start on a byte
+            self.assertEqual(len(raw), 6 + (width + 3) // 4 * height, name)
+            self.assertEqual(compress_icons.raw_pixels(raw), pixels, name)
+            self.assertEqual(compress_icons.encode_rle(width, height, pixels), data, name)
+
+    def test_icons_have_odd_widths(self):
+        # otherwise the round trips above would not cover padded rows
+        widths = {compress_icons.header(data)[2] for data in icons().values()}
+        self.assertTrue(any(width % 4 for width in widths))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Replays recorded OpenWeatherMap responses to the weather station.
+
+Serves <dir>/weather.json for /data/2.5/weather and <dir>/forecast.json for
+/data/2.5/forecast. Build the firmware with
+  -D CONFIG_OPEN_WEATHER_MAP_HOST='"<this machine>"' -D CONFIG_OPEN_WEATHER_MAP_PORT=8080
+to point it here. --chunk/--delay trickle the body to exercise the
+incremental fetcher, --status makes every request fail, --truncate closes
+the connection after that many bytes of the body.
+
+Record responses with e.g.
+  curl -o weather.json "http://api.openweathermap.org/data/2.5/weather?id=<id>&appid=<key>&units=metric"
+"""
+import argparse
+import os
+import time
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+FILES = {"/data/2.5/weather": "weather.json", "/data/2.5/forecast": "forecast.json"}
+
+
+def make_handler(args):
+    class Handler(BaseHTTPRequestHandler):
+        def do_GET(self):
+            name = FILES.get(self.path.split("?")[0])
+            if name is None or args.status != 200:
+                self.send_error(args.status if name else 404)
+                return
+            with open(os.path.join(args.dir, name), "rb") as f:
+                body = f.read()
+            length = len(body)
+            if args.truncate is not None:
+                body = body[:args.truncate]
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(length))
+            self.end_headers()
+            for i in range(0, len(body), args.chunk):
+                self.wfile.write(body[i:i + args.chunk])
+                self.wfile.flush()
+                time.sleep(args.delay)
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dir", help="directory with weather.json and forecast.json")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--chunk", type=int, default=1 << 20, help="bytes written at once")
+    parser.add_argument("--delay", type=float, default=0, help="seconds between chunks")
+    parser.add_argument("--status", type=int, default=200, help="HTTP status to answer with")
+    parser.add_argument("--truncate", type=int, help="bytes of the body sent before closing")
+    args = parser.parse_args()
+    HTTPServer(("", args.port), make_handler(args)).serve_forever()
+
+
+if __name__ == "__main__":
+    main()